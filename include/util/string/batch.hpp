@@ -0,0 +1,300 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_BATCH_HPP_
+#define INCLUDE_UTIL_STRING_BATCH_HPP_
+
+#include <cstddef>
+#include <cwctype>
+#include <string>
+#include <vector>
+#include "util/string/char_set.hpp"
+#include "util/string/simd.hpp"
+#include "util/string/string_view.hpp"
+#include "util/string/trim.hpp"
+
+namespace util {
+
+namespace string {
+
+// Stores many strings back to back in one buffer. Strings are addressed by
+// index and handed out as views, which stay valid until the arena is
+// modified again.
+template <typename T>
+class basic_arena {
+ public:
+  basic_arena() : offsets_(1, 0) {
+  }
+
+  void reserve(std::size_t strings, std::size_t chars) {
+    offsets_.reserve(strings + 1);
+    buffer_.reserve(chars);
+  }
+
+  void clear() {
+    buffer_.clear();
+    offsets_.assign(1, 0);
+  }
+
+  std::size_t size() const {
+    return offsets_.size() - 1;
+  }
+
+  bool empty() const {
+    return size() == 0;
+  }
+
+  basic_string_view<T> operator[](std::size_t i) const {
+    return basic_string_view<T>(buffer_.data() + offsets_[i],
+                                offsets_[i + 1] - offsets_[i]);
+  }
+
+  const std::basic_string<T> &buffer() const {
+    return buffer_;
+  }
+
+  void push_back(basic_string_view<T> s) {
+    buffer_.append(s.data(), s.size());
+    offsets_.push_back(buffer_.size());
+  }
+
+  // Calls f(T *data, std::size_t length) once on the characters of the
+  // strings from index first onwards, which are contiguous.
+  template <typename Function>
+  void map(std::size_t first, Function f) {
+    if (first < size()) {
+      f(&buffer_[0] + offsets_[first], buffer_.size() - offsets_[first]);
+    }
+  }
+
+  // Replaces every string from index first onwards with f(view), which
+  // must return a part of the view it was given. Works in place.
+  template <typename Function>
+  void narrow(std::size_t first, Function f) {
+    std::size_t out = offsets_[first];
+    for (std::size_t i = first; i < size(); i++) {
+      basic_string_view<T> kept = f((*this)[i]);
+      std::char_traits<T>::move(&buffer_[0] + out, kept.data(), kept.size());
+      offsets_[i] = out;
+      out += kept.size();
+    }
+    offsets_.back() = out;
+    buffer_.resize(out);
+  }
+
+  // Replaces every string from index first onwards with whatever
+  // f(view, std::basic_string<T> &out) appends to out.
+  template <typename Function>
+  void rewrite(std::size_t first, Function f) {
+    scratch_.assign(buffer_, 0, offsets_[first]);
+    std::size_t begin = offsets_[first];
+    for (std::size_t i = first; i < size(); i++) {
+      std::size_t end = offsets_[i + 1];
+      offsets_[i] = scratch_.size();
+      f(basic_string_view<T>(buffer_.data() + begin, end - begin), scratch_);
+      begin = end;
+    }
+    offsets_.back() = scratch_.size();
+    buffer_.swap(scratch_);
+  }
+
+ private:
+  std::basic_string<T> buffer_;
+  std::basic_string<T> scratch_;
+  std::vector<std::size_t> offsets_;
+};
+
+typedef basic_arena<char> arena;
+typedef basic_arena<wchar_t> warena;
+
+// Operations applied to a whole batch of strings. Each operation runs over
+// every string of the batch before the next one starts, so per-character
+// operations see the batch as one contiguous buffer, and operations that
+// change lengths compact the arena in place or rebuild it into a buffer
+// that the arena keeps for the next batch.
+namespace batch {
+
+namespace internal {
+
+inline void lowercase(char *s, std::size_t length) {
+  util::string::internal::shiftRange(s, length, 'A', 'Z', 0x20);
+}
+
+inline void lowercase(wchar_t *s, std::size_t length) {
+  for (std::size_t i = 0; i < length; i++) {
+    s[i] = std::towlower(s[i]);
+  }
+}
+
+inline void uppercase(char *s, std::size_t length) {
+  util::string::internal::shiftRange(s, length, 'a', 'z', -0x20);
+}
+
+inline void uppercase(wchar_t *s, std::size_t length) {
+  for (std::size_t i = 0; i < length; i++) {
+    s[i] = std::towupper(s[i]);
+  }
+}
+
+}  // namespace internal
+
+struct lowercase_op {
+  template <typename T>
+  void operator()(basic_arena<T> &arena, std::size_t first) const {
+    arena.map(first, [](T *s, std::size_t length) {
+      internal::lowercase(s, length);
+    });
+  }
+};
+
+struct uppercase_op {
+  template <typename T>
+  void operator()(basic_arena<T> &arena, std::size_t first) const {
+    arena.map(first, [](T *s, std::size_t length) {
+      internal::uppercase(s, length);
+    });
+  }
+};
+
+template <typename T>
+struct trim_op {
+  basic_char_set<T> set;
+
+  void operator()(basic_arena<T> &arena, std::size_t first) const {
+    const basic_char_set<T> &chars = set;
+    arena.narrow(first, [&](basic_string_view<T> s) {
+      return util::string::trim(s, chars);
+    });
+  }
+};
+
+template <typename T>
+struct replace_op {
+  std::basic_string<T> from;
+  std::basic_string<T> to;
+
+  void operator()(basic_arena<T> &arena, std::size_t first) const {
+    if (from.empty()) {
+      return;
+    }
+    const std::basic_string<T> &needle = from;
+    const std::basic_string<T> &replacement = to;
+    arena.rewrite(first, [&](basic_string_view<T> s,
+                             std::basic_string<T> &out) {
+      std::size_t position = 0;
+      std::size_t found;
+      while ((found = s.find(needle, position)) != s.npos) {
+        out.append(s.data() + position, found - position);
+        out.append(replacement);
+        position = found + needle.size();
+      }
+      out.append(s.data() + position, s.size() - position);
+    });
+  }
+};
+
+template <typename T>
+struct translate_op {
+  std::basic_string<T> from;
+  std::basic_string<T> to;
+
+  void operator()(basic_arena<T> &arena, std::size_t first) const {
+    const std::size_t length = std::min(from.size(), to.size());
+    const std::basic_string<T> &source = from;
+    const std::basic_string<T> &target = to;
+    arena.map(first, [&](T *s, std::size_t count) {
+      for (std::size_t i = 0; i < count; i++) {
+        for (std::size_t j = 0; j < length; j++) {
+          if (s[i] == source[j]) {
+            s[i] = target[j];
+            break;
+          }
+        }
+      }
+    });
+  }
+};
+
+inline lowercase_op lowercase() {
+  return lowercase_op();
+}
+
+inline uppercase_op uppercase() {
+  return uppercase_op();
+}
+
+inline trim_op<char> trim() {
+  return trim_op<char>{whitespace()};
+}
+
+template <typename T>
+inline trim_op<T> trim(const T *chars) {
+  return trim_op<T>{basic_char_set<T>(chars)};
+}
+
+template <typename T>
+inline replace_op<T> replace(const T *from, const T *to) {
+  return replace_op<T>{from, to};
+}
+
+template <typename T>
+inline translate_op<T> translate(const T *from, const T *to) {
+  return translate_op<T>{from, to};
+}
+
+namespace internal {
+
+template <typename T>
+inline void run(basic_arena<T> &, std::size_t) {
+}
+
+template <typename T, typename Op, typename ... Ops>
+inline void run(basic_arena<T> &arena, std::size_t first,
+                const Op &op, const Ops& ... ops) {
+  op(arena, first);
+  run(arena, first, ops ...);
+}
+
+}  // namespace internal
+
+// Appends every string of inputs to the arena and applies ops to them in
+// order, e.g. apply(lines, arena, trim(), lowercase(), replace("a", "b")).
+// The elements of inputs only need to convert to basic_string_view<T>.
+template <typename T, typename Range, typename ... Ops>
+inline void apply(const Range &inputs, basic_arena<T> &arena,
+                  const Ops& ... ops) {
+  const std::size_t first = arena.size();
+  for (const auto &input : inputs) {
+    arena.push_back(basic_string_view<T>(input));
+  }
+  internal::run(arena, first, ops ...);
+}
+
+}  // namespace batch
+
+}  // namespace string
+
+}  // namespace util
+
+#endif  // INCLUDE_UTIL_STRING_BATCH_HPP_
@@ -0,0 +1,348 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_BUILDER_HPP_
+#define INCLUDE_UTIL_STRING_BUILDER_HPP_
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cwchar>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "util/string/format.hpp"
+#include "util/string/string_view.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/uio.h>
+#include <climits>
+#include <system_error>
+#define UTIL_STRING_HAVE_WRITEV 1
+#endif
+
+namespace util {
+
+namespace string {
+
+namespace internal {
+
+// Formats args into the size characters at buf when the output fits, and
+// returns its length either way. Throws std::invalid_argument if the
+// output cannot be produced.
+template <typename ... Args>
+inline std::size_t formatInto(char *buf, std::size_t size, const char *fmt,
+                              const Args& ... args) {
+  int length = std::snprintf(buf, size, fmt, to_const(args) ...);
+  if (length < 0) {
+    throw std::invalid_argument("invalid format or argument");
+  }
+  return static_cast<std::size_t>(length);
+}
+
+inline bool isEncodingError() {
+  return errno == EILSEQ || errno == EINVAL;
+}
+
+// swprintf only reports that the output did not fit, so the length is
+// found by formatting into a growing scratch buffer, up to 1M characters
+template <typename ... Args>
+inline std::size_t formatInto(wchar_t *buf, std::size_t size,
+                              const wchar_t *fmt, const Args& ... args) {
+  errno = 0;
+  int length = size > 0 ? std::swprintf(buf, size, fmt, to_const(args) ...)
+                        : -1;
+  if (length >= 0) {
+    return static_cast<std::size_t>(length);
+  }
+  const std::size_t MAX_SIZE = 1024 * 1024;
+  scratch::buffer<wchar_t> scratch(std::max<std::size_t>(size * 2, 256));
+  while (!isEncodingError()) {
+    errno = 0;
+    length = std::swprintf(scratch.data(), scratch.size(), fmt,
+                           to_const(args) ...);
+    if (length >= 0) {
+      return static_cast<std::size_t>(length);
+    }
+    if (scratch.size() >= MAX_SIZE) {
+      throw std::invalid_argument("format output too long");
+    }
+    scratch.resize(scratch.size() * 2);
+  }
+  throw std::invalid_argument("invalid format or argument");
+}
+
+}  // namespace internal
+
+// Builds a large string out of many pieces without ever moving what has
+// already been appended. Copied pieces go into chunks that double in size
+// up to a megabyte and are never reallocated; pieces appended with
+// appendRef() are not copied at all and must outlive the builder. The
+// result is a sequence of segments, which str() flattens with a single
+// allocation and writeTo() hands to writev() as they are.
+template <typename T>
+class basic_string_builder {
+ public:
+  typedef basic_string_view<T> view;
+
+  basic_string_builder()
+      : size_(0), next_(FIRST_CHUNK), write_(nullptr), room_(0),
+        owned_(false) {
+  }
+
+  // A moved-from builder is empty, as it no longer owns the chunk its
+  // write position points into
+  basic_string_builder(basic_string_builder &&other)
+      : basic_string_builder() {
+    swap(other);
+  }
+
+  basic_string_builder &operator=(basic_string_builder &&other) {
+    clear();
+    swap(other);
+    return *this;
+  }
+
+  void swap(basic_string_builder &other) {
+    segments_.swap(other.segments_);
+    chunks_.swap(other.chunks_);
+    std::swap(size_, other.size_);
+    std::swap(next_, other.next_);
+    std::swap(write_, other.write_);
+    std::swap(room_, other.room_);
+    std::swap(owned_, other.owned_);
+  }
+
+  basic_string_builder &append(view s) {
+    if (!s.empty()) {
+      std::copy(s.data(), s.data() + s.size(), reserve(s.size()));
+      commit(s.size());
+    }
+    return *this;
+  }
+
+  basic_string_builder &append(const T *s) {
+    return append(view(s));
+  }
+
+  basic_string_builder &append(const std::basic_string<T> &s) {
+    return append(view(s));
+  }
+
+  basic_string_builder &append(std::size_t count, T ch) {
+    if (count > 0) {
+      std::fill_n(reserve(count), count, ch);
+      commit(count);
+    }
+    return *this;
+  }
+
+  basic_string_builder &append(T ch) {
+    return append(1, ch);
+  }
+
+  // Records s by reference; its characters must stay valid and unchanged
+  // until the builder is flattened or written out
+  basic_string_builder &appendRef(view s) {
+    if (!s.empty()) {
+      segments_.push_back(s);
+      size_ += s.size();
+      owned_ = false;
+    }
+    return *this;
+  }
+
+  // Appends the printf-style formatting of args, written straight into the
+  // chunk. Throws std::invalid_argument if the output cannot be produced,
+  // leaving the builder as it was.
+  template <typename ... Args>
+  basic_string_builder &appendFormat(const T *fmt, const Args& ... args) {
+    const std::size_t length =
+        internal::formatInto(write_, room_, fmt, args ...);
+    if (length >= room_) {
+      internal::formatInto(reserve(length + 1), length + 1, fmt, args ...);
+    }
+    commit(length);
+    return *this;
+  }
+
+  // Appends the elements of tokens with delim between them
+  template <typename Range>
+  basic_string_builder &appendJoin(const Range &tokens, view delim) {
+    bool first = true;
+    for (const auto &token : tokens) {
+      if (!first) {
+        append(delim);
+      }
+      append(view(token));
+      first = false;
+    }
+    return *this;
+  }
+
+  basic_string_builder &operator<<(view s) {
+    return append(s);
+  }
+
+  basic_string_builder &operator<<(const T *s) {
+    return append(s);
+  }
+
+  basic_string_builder &operator<<(const std::basic_string<T> &s) {
+    return append(s);
+  }
+
+  basic_string_builder &operator<<(T ch) {
+    return append(ch);
+  }
+
+  std::size_t size() const { return size_; }
+
+  bool empty() const { return size_ == 0; }
+
+  // The pieces of the string, in order
+  const std::vector<view> &segments() const { return segments_; }
+
+  void clear() {
+    segments_.clear();
+    chunks_.clear();
+    size_ = 0;
+    next_ = FIRST_CHUNK;
+    write_ = nullptr;
+    room_ = 0;
+    owned_ = false;
+  }
+
+  void appendTo(std::basic_string<T> &out) const {
+    out.reserve(out.size() + size_);
+    for (const view &segment : segments_) {
+      out.append(segment.data(), segment.size());
+    }
+  }
+
+  std::basic_string<T> str() const {
+    std::basic_string<T> out;
+    appendTo(out);
+    return out;
+  }
+
+#ifdef UTIL_STRING_HAVE_WRITEV
+  std::vector<struct iovec> iovecs() const {
+    std::vector<struct iovec> iov(segments_.size());
+    for (std::size_t i = 0; i < segments_.size(); i++) {
+      iov[i].iov_base = const_cast<T *>(segments_[i].data());
+      iov[i].iov_len = segments_[i].size() * sizeof(T);
+    }
+    return iov;
+  }
+
+  // Writes the whole string to fd with as few writev() calls as the
+  // system's iovec limit allows, resuming after partial writes. Returns
+  // the number of bytes written; throws std::system_error on failure.
+  std::size_t writeTo(int fd) const {
+#ifdef IOV_MAX
+    const std::size_t MAX_IOV = IOV_MAX;
+#else
+    const std::size_t MAX_IOV = 1024;
+#endif
+    std::vector<struct iovec> iov = iovecs();
+    std::size_t first = 0;
+    std::size_t written = 0;
+    while (first < iov.size()) {
+      const std::size_t count = std::min(iov.size() - first, MAX_IOV);
+      const ssize_t n = ::writev(fd, &iov[first], static_cast<int>(count));
+      if (n < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        throw std::system_error(errno, std::generic_category(), "writev");
+      }
+      written += n;
+      std::size_t left = n;
+      while (first < iov.size() && left >= iov[first].iov_len) {
+        left -= iov[first].iov_len;
+        first++;
+      }
+      if (left > 0) {
+        iov[first].iov_base = static_cast<char *>(iov[first].iov_base) + left;
+        iov[first].iov_len -= left;
+      }
+    }
+    return written;
+  }
+#endif
+
+ private:
+  static const std::size_t FIRST_CHUNK = 1024;
+  static const std::size_t MAX_CHUNK = 1024 * 1024 / sizeof(T);
+
+  // Room for count characters at the end of the current chunk, starting a
+  // new chunk if needed. The old chunk's unused tail is abandoned.
+  T *reserve(std::size_t count) {
+    if (count > room_) {
+      const std::size_t capacity = std::max(next_, count);
+      chunks_.emplace_back(new T[capacity]);
+      write_ = chunks_.back().get();
+      room_ = capacity;
+      next_ = next_ * 2 < MAX_CHUNK ? next_ * 2 : MAX_CHUNK;
+      owned_ = false;
+    }
+    return write_;
+  }
+
+  // Adds the count characters just written at write_ to the string,
+  // extending the last segment when they directly follow it
+  void commit(std::size_t count) {
+    if (owned_) {
+      view &last = segments_.back();
+      last = view(last.data(), last.size() + count);
+    } else {
+      segments_.push_back(view(write_, count));
+      owned_ = true;
+    }
+    write_ += count;
+    room_ -= count;
+    size_ += count;
+  }
+
+  std::vector<view> segments_;
+  std::vector<std::unique_ptr<T[]>> chunks_;
+  std::size_t size_;
+  std::size_t next_;
+  T *write_;
+  std::size_t room_;
+  bool owned_;  // whether the last segment ends at write_
+};
+
+typedef basic_string_builder<char> string_builder;
+typedef basic_string_builder<wchar_t> wstring_builder;
+
+}  // namespace string
+
+}  // namespace util
+
+#endif  // INCLUDE_UTIL_STRING_BUILDER_HPP_
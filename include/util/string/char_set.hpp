@@ -0,0 +1,163 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_CHAR_SET_HPP_
+#define INCLUDE_UTIL_STRING_CHAR_SET_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include "util/string/simd.hpp"
+
+namespace util {
+
+namespace string {
+
+namespace internal {
+
+// Keeps a parameter out of template argument deduction
+template <typename T>
+struct identity {
+  typedef T type;
+};
+
+}  // namespace internal
+
+// A set of characters to trim, given as a literal such as " \t\r\n".
+// Membership of the first 256 code units is a bitmap lookup; for char, the
+// trim functions scan both ends 16 bytes at a time when SSE2 is available.
+template <typename T>
+class basic_char_set {
+ public:
+  basic_char_set(const T *chars)  // NOLINT
+      : basic_char_set(std::basic_string<T>(chars)) {
+  }
+
+  basic_char_set(const std::basic_string<T> &chars)  // NOLINT
+      : members_(chars) {
+    std::sort(members_.begin(), members_.end());
+    members_.erase(std::unique(members_.begin(), members_.end()),
+                   members_.end());
+    bitmap_.fill(0);
+    for (const T ch : members_) {
+      auto code = index(ch);
+      if (code < 256) {
+        bitmap_[code / 64] |= std::uint64_t(1) << (code % 64);
+      }
+    }
+  }
+
+  bool operator()(const T ch) const {
+    auto code = index(ch);
+    if (code < 256) {
+      return (bitmap_[code / 64] >> (code % 64)) & 1;
+    }
+    return std::binary_search(members_.begin(), members_.end(), ch);
+  }
+
+  const std::basic_string<T> &members() const {
+    return members_;
+  }
+
+  // Returns the number of leading characters of s that are in the set.
+  std::size_t span(const T *s, std::size_t length) const {
+    return std::find_if_not(s, s + length, predicate()) - s;
+  }
+
+  // Returns the number of trailing characters of s that are in the set.
+  std::size_t rspan(const T *s, std::size_t length) const {
+    std::reverse_iterator<const T *> first(s + length);
+    std::reverse_iterator<const T *> last(s);
+    return std::find_if_not(first, last, predicate()) - first;
+  }
+
+ private:
+  // Membership as a predicate that refers to the set, since the algorithms
+  // take theirs by value and copying the set copies members_
+  struct member_of {
+    const basic_char_set *set;
+
+    bool operator()(const T ch) const {
+      return (*set)(ch);
+    }
+  };
+
+  member_of predicate() const {
+    return member_of{this};
+  }
+
+  static std::size_t index(const T ch) {
+    return static_cast<typename std::make_unsigned<T>::type>(ch);
+  }
+
+  std::basic_string<T> members_;
+  std::array<std::uint64_t, 4> bitmap_;
+};
+
+template <>
+inline std::size_t basic_char_set<char>::span(const char *s,
+                                              std::size_t length) const {
+  if (members_.size() > 8) {
+    return std::find_if_not(s, s + length, predicate()) - s;
+  }
+  return internal::spanOf(s, length, members_.data(), members_.size());
+}
+
+template <>
+inline std::size_t basic_char_set<char>::rspan(const char *s,
+                                               std::size_t length) const {
+  if (members_.size() > 8) {
+    std::reverse_iterator<const char *> first(s + length);
+    std::reverse_iterator<const char *> last(s);
+    return std::find_if_not(first, last, predicate()) - first;
+  }
+  return internal::rspanOf(s, length, members_.data(), members_.size());
+}
+
+typedef basic_char_set<char> char_set;
+typedef basic_char_set<wchar_t> wchar_set;
+
+// The whitespace characters of the "C" locale
+inline const char_set &whitespace() {
+  static const char_set set(" \t\n\v\f\r");
+  return set;
+}
+
+#define UTIL_STRING_INSTANTIATE_CHAR_SET(EXTERN, T)                           \
+  EXTERN template class basic_char_set<T>;
+
+#ifdef UTIL_STRING_EXTERN_TEMPLATES
+UTIL_STRING_INSTANTIATE_CHAR_SET(extern, char)
+UTIL_STRING_INSTANTIATE_CHAR_SET(extern, wchar_t)
+#endif
+
+}  // namespace string
+
+}  // namespace util
+
+#endif  // INCLUDE_UTIL_STRING_CHAR_SET_HPP_
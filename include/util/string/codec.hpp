@@ -0,0 +1,353 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_CODEC_HPP_
+#define INCLUDE_UTIL_STRING_CODEC_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include "util/string/simd.hpp"
+#include "util/string/string_view.hpp"
+
+namespace util {
+
+namespace string {
+
+// Hex and base64 (RFC 4648) codecs. Every encoder and decoder has a form
+// that appends to an existing buffer, and the *Size functions give the
+// exact output size up front. Decoders are strict: they throw
+// std::invalid_argument naming the offset of the first bad character, and
+// reject truncated input and base64 with non-zero padding bits.
+enum class Base64 {
+  Standard,  // '+' and '/', padded with '='
+  UrlSafe    // '-' and '_', unpadded
+};
+
+namespace internal {
+
+static const char LOWER_HEX_DIGITS[] = "0123456789abcdef";
+
+inline const char *base64Alphabet(Base64 alphabet) {
+  return alphabet == Base64::Standard
+      ? "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"
+      : "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+}
+
+// Maps each byte to its value, or to 0xFF when it is not a digit
+typedef std::array<std::uint8_t, 256> decode_table;
+
+inline decode_table makeDecodeTable(const char *digits, std::size_t count) {
+  decode_table table;
+  table.fill(0xFF);
+  for (std::size_t i = 0; i < count; i++) {
+    table[static_cast<unsigned char>(digits[i])] =
+        static_cast<std::uint8_t>(i);
+  }
+  return table;
+}
+
+inline const decode_table &hexTable() {
+  static const decode_table table = [] {
+    decode_table t = makeDecodeTable("0123456789abcdef", 16);
+    for (int i = 0; i < 6; i++) {
+      t['A' + i] = static_cast<std::uint8_t>(10 + i);
+    }
+    return t;
+  }();
+  return table;
+}
+
+inline const decode_table &base64Table(Base64 alphabet) {
+  static const decode_table standard =
+      makeDecodeTable(base64Alphabet(Base64::Standard), 64);
+  static const decode_table urlSafe =
+      makeDecodeTable(base64Alphabet(Base64::UrlSafe), 64);
+  return alphabet == Base64::Standard ? standard : urlSafe;
+}
+
+[[noreturn]] inline void invalidCharacter(const char *codec,
+                                          std::size_t offset) {
+  throw std::invalid_argument(std::string("invalid ") + codec +
+                              " character at offset " +
+                              std::to_string(offset));
+}
+
+// Grows out by count bytes and returns where they start
+inline char *extend(std::string &out, std::size_t count) {
+  const std::size_t size = out.size();
+  out.resize(size + count);
+  return &out[0] + size;
+}
+
+// Length of text without its '=' padding
+inline std::size_t unpaddedLength(string_view text) {
+  std::size_t length = text.size();
+  if (length % 4 == 0) {
+    for (int i = 0; i < 2 && length > 0 && text[length - 1] == '='; i++) {
+      length--;
+    }
+  }
+  return length;
+}
+
+}  // namespace internal
+
+inline std::size_t hexEncodedSize(std::size_t length) {
+  return length * 2;
+}
+
+inline std::size_t hexDecodedSize(std::size_t length) {
+  return length / 2;
+}
+
+// Appends the lowercase hex digits of every byte of data
+inline void encodeHex(string_view data, std::string &out) {
+  const unsigned char *in =
+      reinterpret_cast<const unsigned char *>(data.data());
+  char *p = internal::extend(out, hexEncodedSize(data.size()));
+  std::size_t i = 0;
+#ifdef UTIL_STRING_HAVE_SSE2
+  const __m128i nibble = _mm_set1_epi8(0x0F);
+  const __m128i nine = _mm_set1_epi8(9);
+  const __m128i letterGap = _mm_set1_epi8('a' - '0' - 10);
+  const __m128i zero = _mm_set1_epi8('0');
+  for (; i + 16 <= data.size(); i += 16, p += 32) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+    __m128i high = _mm_and_si128(_mm_srli_epi16(chunk, 4), nibble);
+    __m128i low = _mm_and_si128(chunk, nibble);
+    __m128i first = _mm_unpacklo_epi8(high, low);
+    __m128i second = _mm_unpackhi_epi8(high, low);
+    first = _mm_add_epi8(_mm_add_epi8(first, zero),
+                         _mm_and_si128(_mm_cmpgt_epi8(first, nine), letterGap));
+    second = _mm_add_epi8(
+        _mm_add_epi8(second, zero),
+        _mm_and_si128(_mm_cmpgt_epi8(second, nine), letterGap));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(p), first);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(p + 16), second);
+  }
+#endif
+  for (; i < data.size(); i++) {
+    *p++ = internal::LOWER_HEX_DIGITS[in[i] >> 4];
+    *p++ = internal::LOWER_HEX_DIGITS[in[i] & 0xF];
+  }
+}
+
+inline std::string encodeHex(string_view data) {
+  std::string out;
+  encodeHex(data, out);
+  return out;
+}
+
+// Appends the bytes spelled by text, which may mix upper and lower case
+inline void decodeHex(string_view text, std::string &out) {
+  if (text.size() % 2 != 0) {
+    throw std::invalid_argument("hex input has odd length");
+  }
+  const std::size_t size = out.size();
+  char *p = internal::extend(out, hexDecodedSize(text.size()));
+  const char *in = text.data();
+  std::size_t i = 0;
+#ifdef UTIL_STRING_HAVE_SSE2
+  const __m128i lowerBit = _mm_set1_epi8(0x20);
+  const __m128i lowByte = _mm_set1_epi16(0x00FF);
+  for (; i + 32 <= text.size(); i += 32, p += 16) {
+    __m128i halves[2];
+    bool valid = true;
+    for (int h = 0; h < 2; h++) {
+      __m128i chunk =
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i + 16 * h));
+      __m128i isDigit = internal::inRange(chunk, '0', '9');
+      __m128i folded = _mm_or_si128(chunk, lowerBit);
+      __m128i isLetter = internal::inRange(folded, 'a', 'f');
+      if (_mm_movemask_epi8(_mm_or_si128(isDigit, isLetter)) != 0xFFFF) {
+        valid = false;
+        break;
+      }
+      __m128i digits = _mm_and_si128(
+          isDigit, _mm_sub_epi8(chunk, _mm_set1_epi8('0')));
+      __m128i letters = _mm_and_si128(
+          isLetter, _mm_sub_epi8(folded, _mm_set1_epi8('a' - 10)));
+      __m128i values = _mm_or_si128(digits, letters);
+      // Each 16-bit lane holds a high nibble in its low byte and the
+      // matching low nibble in its high byte
+      halves[h] =
+          _mm_or_si128(_mm_slli_epi16(_mm_and_si128(values, lowByte), 4),
+                       _mm_srli_epi16(values, 8));
+    }
+    if (!valid) {
+      break;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(p),
+                     _mm_packus_epi16(halves[0], halves[1]));
+  }
+#endif
+  const internal::decode_table &table = internal::hexTable();
+  for (; i < text.size(); i += 2) {
+    const std::uint8_t high = table[static_cast<unsigned char>(in[i])];
+    const std::uint8_t low = table[static_cast<unsigned char>(in[i + 1])];
+    if (high == 0xFF || low == 0xFF) {
+      out.resize(size);
+      internal::invalidCharacter("hex", high == 0xFF ? i : i + 1);
+    }
+    *p++ = static_cast<char>((high << 4) | low);
+  }
+}
+
+inline std::string decodeHex(string_view text) {
+  std::string out;
+  decodeHex(text, out);
+  return out;
+}
+
+inline std::size_t base64EncodedSize(std::size_t length,
+                                     Base64 alphabet = Base64::Standard) {
+  if (alphabet == Base64::Standard) {
+    return (length + 2) / 3 * 4;
+  }
+  return length / 3 * 4 + (length % 3 == 0 ? 0 : length % 3 + 1);
+}
+
+// Exact size of the decoded form of text, assuming it is well-formed
+inline std::size_t base64DecodedSize(string_view text) {
+  const std::size_t length = internal::unpaddedLength(text);
+  return length / 4 * 3 + (length % 4 == 0 ? 0 : length % 4 - 1);
+}
+
+inline void encodeBase64(string_view data, std::string &out,
+                         Base64 alphabet = Base64::Standard) {
+  const char *digits = internal::base64Alphabet(alphabet);
+  const unsigned char *in =
+      reinterpret_cast<const unsigned char *>(data.data());
+  const std::size_t length = data.size();
+  char *p = internal::extend(out, base64EncodedSize(length, alphabet));
+  std::size_t i = 0;
+  for (; i + 3 <= length; i += 3, p += 4) {
+    const std::uint32_t group = (static_cast<std::uint32_t>(in[i]) << 16) |
+        (static_cast<std::uint32_t>(in[i + 1]) << 8) | in[i + 2];
+    p[0] = digits[group >> 18];
+    p[1] = digits[(group >> 12) & 0x3F];
+    p[2] = digits[(group >> 6) & 0x3F];
+    p[3] = digits[group & 0x3F];
+  }
+  if (i == length) {
+    return;
+  }
+  std::uint32_t group = static_cast<std::uint32_t>(in[i]) << 16;
+  if (i + 1 < length) {
+    group |= static_cast<std::uint32_t>(in[i + 1]) << 8;
+  }
+  *p++ = digits[group >> 18];
+  *p++ = digits[(group >> 12) & 0x3F];
+  if (i + 1 < length) {
+    *p++ = digits[(group >> 6) & 0x3F];
+  } else if (alphabet == Base64::Standard) {
+    *p++ = '=';
+  }
+  if (alphabet == Base64::Standard) {
+    *p = '=';
+  }
+}
+
+inline std::string encodeBase64(string_view data,
+                                Base64 alphabet = Base64::Standard) {
+  std::string out;
+  encodeBase64(data, out, alphabet);
+  return out;
+}
+
+// Standard input must be padded to a multiple of four characters; URL-safe
+// input may be padded or not.
+inline void decodeBase64(string_view text, std::string &out,
+                         Base64 alphabet = Base64::Standard) {
+  if (alphabet == Base64::Standard && text.size() % 4 != 0) {
+    throw std::invalid_argument("base64 input is not padded");
+  }
+  const std::size_t length = internal::unpaddedLength(text);
+  if (length % 4 == 1) {
+    throw std::invalid_argument("base64 input is truncated");
+  }
+  const internal::decode_table &table = internal::base64Table(alphabet);
+  const unsigned char *in =
+      reinterpret_cast<const unsigned char *>(text.data());
+  const std::size_t size = out.size();
+  char *p = internal::extend(out, base64DecodedSize(text));
+  std::size_t i = 0;
+  for (; i + 4 <= length; i += 4, p += 3) {
+    const std::uint8_t a = table[in[i]];
+    const std::uint8_t b = table[in[i + 1]];
+    const std::uint8_t c = table[in[i + 2]];
+    const std::uint8_t d = table[in[i + 3]];
+    // Valid digits are below 64, so one test covers all four
+    if ((a | b | c | d) & 0x80) {
+      break;
+    }
+    const std::uint32_t group = (static_cast<std::uint32_t>(a) << 18) |
+        (static_cast<std::uint32_t>(b) << 12) |
+        (static_cast<std::uint32_t>(c) << 6) | d;
+    p[0] = static_cast<char>(group >> 16);
+    p[1] = static_cast<char>(group >> 8);
+    p[2] = static_cast<char>(group);
+  }
+  std::uint32_t group = 0;
+  for (std::size_t j = i; j < length; j++) {
+    const std::uint8_t value = table[in[j]];
+    if (value == 0xFF) {
+      out.resize(size);
+      internal::invalidCharacter("base64", j);
+    }
+    group = (group << 6) | value;
+  }
+  // A final group of two or three characters carries 4 or 2 spare bits,
+  // which a canonical encoder leaves at zero
+  if (length % 4 == 2) {
+    if (group & 0x0F) {
+      out.resize(size);
+      throw std::invalid_argument("base64 input has non-zero padding bits");
+    }
+    *p = static_cast<char>(group >> 4);
+  } else if (length % 4 == 3) {
+    if (group & 0x03) {
+      out.resize(size);
+      throw std::invalid_argument("base64 input has non-zero padding bits");
+    }
+    p[0] = static_cast<char>(group >> 10);
+    p[1] = static_cast<char>(group >> 2);
+  }
+}
+
+inline std::string decodeBase64(string_view text,
+                                Base64 alphabet = Base64::Standard) {
+  std::string out;
+  decodeBase64(text, out, alphabet);
+  return out;
+}
+
+}  // namespace string
+
+}  // namespace util
+
+#endif  // INCLUDE_UTIL_STRING_CODEC_HPP_
@@ -0,0 +1,215 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_CSV_HPP_
+#define INCLUDE_UTIL_STRING_CSV_HPP_
+
+#include <cstddef>
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "util/string/simd.hpp"
+#include "util/string/string_view.hpp"
+
+namespace util {
+
+namespace string {
+
+// The characters that structure a delimited file. When escape equals quote
+// (the default, as in RFC 4180) a quote inside a quoted field is written
+// twice. Any other escape character takes the next character literally,
+// inside or outside quotes, so that "a\,b" is one field.
+template <typename T>
+struct basic_csv_format {
+  T delimiter;
+  T quote;
+  T escape;
+
+  basic_csv_format(T delimiter = T(','), T quote = T('"'))
+      : delimiter(delimiter), quote(quote), escape(quote) {
+  }
+
+  basic_csv_format(T delimiter, T quote, T escape)
+      : delimiter(delimiter), quote(quote), escape(escape) {
+  }
+};
+
+// Reads delimited records from a buffer one at a time. Records end at '\n'
+// or "\r\n" outside quotes; quoted fields may span lines. Fields come back
+// as views: straight into the buffer when the field has no escapes, or
+// into storage owned by the reader when an escape had to be resolved. All
+// of them stay valid until the next call to next().
+//
+// The scan for delimiters, quotes and newlines goes 16 bytes at a time
+// with SSE2 for char. Throws std::invalid_argument on an unterminated
+// quoted field, on text between a closing quote and the next delimiter,
+// and on an escape character at the very end of the input.
+template <typename T>
+class basic_csv_reader {
+ public:
+  explicit basic_csv_reader(basic_string_view<T> s,
+                            const basic_csv_format<T> &format =
+                                basic_csv_format<T>())
+      : format_(format), p_(s.data()), end_(s.data() + s.size()),
+        used_(0) {
+    stops_[0] = format.delimiter;
+    stops_[1] = T('\n');
+    stops_[2] = format.escape;
+    quoted_[0] = format.quote;
+    quoted_[1] = format.escape;
+  }
+
+  // Reads the next record into fields; returns false at the end of input
+  bool next(std::vector<basic_string_view<T>> &fields) {
+    fields.clear();
+    used_ = 0;
+    if (p_ == end_) {
+      return false;
+    }
+    while (true) {
+      fields.push_back(*p_ == format_.quote ? quotedField() : plainField());
+      if (p_ == end_) {
+        return true;
+      }
+      if (*p_ == T('\n')) {
+        ++p_;
+        return true;
+      }
+      // Delimiter: another field follows, even at the end of input
+      if (++p_ == end_) {
+        fields.push_back(basic_string_view<T>());
+        return true;
+      }
+    }
+  }
+
+ private:
+  bool hasEscape() const {
+    return format_.escape != format_.quote;
+  }
+
+  std::basic_string<T> &scratch() {
+    if (used_ == scratch_.size()) {
+      scratch_.emplace_back();
+    }
+    std::basic_string<T> &buffer = scratch_[used_++];
+    buffer.clear();
+    return buffer;
+  }
+
+  T escaped(const T *escape) {
+    if (escape + 1 == end_) {
+      throw std::invalid_argument("escape character at end of input");
+    }
+    return escape[1];
+  }
+
+  basic_string_view<T> plainField() {
+    const T *start = p_;
+    const T *run = p_;
+    const T *q;
+    std::basic_string<T> *buffer = nullptr;
+    const std::size_t stops = hasEscape() ? 3 : 2;
+    while (true) {
+      q = run + internal::cspanOf(run, end_ - run, stops_, stops);
+      if (q == end_ || !hasEscape() || *q != format_.escape) {
+        break;
+      }
+      if (buffer == nullptr) {
+        buffer = &scratch();
+      }
+      buffer->append(run, q);
+      buffer->push_back(escaped(q));
+      run = q + 2;
+    }
+    p_ = q;
+    basic_string_view<T> field(start, q - start);
+    if (buffer != nullptr) {
+      buffer->append(run, q);
+      field = basic_string_view<T>(*buffer);
+    }
+    if (!field.empty() && field.back() == T('\r') &&
+        (p_ == end_ || *p_ == T('\n'))) {
+      field.remove_suffix(1);
+    }
+    return field;
+  }
+
+  basic_string_view<T> quotedField() {
+    const T *start = ++p_;
+    const T *run = start;
+    const T *q;
+    std::basic_string<T> *buffer = nullptr;
+    const std::size_t stops = hasEscape() ? 2 : 1;
+    while (true) {
+      q = run + internal::cspanOf(run, end_ - run, quoted_, stops);
+      if (q == end_) {
+        throw std::invalid_argument("unterminated quoted field");
+      }
+      bool doubled = !hasEscape() && q + 1 != end_ && q[1] == format_.quote;
+      if (*q == format_.quote && !doubled) {
+        break;
+      }
+      if (buffer == nullptr) {
+        buffer = &scratch();
+      }
+      buffer->append(run, q);
+      buffer->push_back(doubled ? format_.quote : escaped(q));
+      run = q + 2;
+    }
+    basic_string_view<T> field(start, q - start);
+    if (buffer != nullptr) {
+      buffer->append(run, q);
+      field = basic_string_view<T>(*buffer);
+    }
+    p_ = q + 1;
+    if (p_ != end_ && *p_ == T('\r') && (p_ + 1 == end_ || p_[1] == T('\n'))) {
+      ++p_;
+    }
+    if (p_ != end_ && *p_ != format_.delimiter && *p_ != T('\n')) {
+      throw std::invalid_argument("unexpected character after quoted field");
+    }
+    return field;
+  }
+
+  basic_csv_format<T> format_;
+  const T *p_;
+  const T *end_;
+  T stops_[3];
+  T quoted_[2];
+  std::deque<std::basic_string<T>> scratch_;
+  std::size_t used_;
+};
+
+typedef basic_csv_format<char> csv_format;
+typedef basic_csv_format<wchar_t> wcsv_format;
+typedef basic_csv_reader<char> csv_reader;
+typedef basic_csv_reader<wchar_t> wcsv_reader;
+
+}  // namespace string
+
+}  // namespace util
+
+#endif  // INCLUDE_UTIL_STRING_CSV_HPP_
@@ -0,0 +1,444 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_DISTANCE_HPP_
+#define INCLUDE_UTIL_STRING_DISTANCE_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+#include "util/string/string_view.hpp"
+
+namespace util {
+
+namespace string {
+
+// Edit distances and similarity scores for byte strings. The distances use
+// the bit-parallel algorithms of Myers and Hyyrö, which process 64 pattern
+// characters per machine word, so a comparison against a pattern of up to
+// 64 characters costs a handful of instructions per text character.
+//
+// A distance greater than maxDistance is reported as maxDistance + 1, and
+// the computation stops as soon as the bound can no longer be met.
+static const std::size_t NO_LIMIT = std::numeric_limits<std::size_t>::max();
+
+namespace internal {
+
+// Zero-initialised words, kept inline for short patterns
+class word_buffer {
+ public:
+  explicit word_buffer(std::size_t count) : data_(local_) {
+    if (count > LOCAL_WORDS) {
+      heap_.resize(count);
+      data_ = heap_.data();
+    } else {
+      std::fill(local_, local_ + count, 0);
+    }
+  }
+
+  word_buffer(const word_buffer &) = delete;
+  word_buffer &operator=(const word_buffer &) = delete;
+
+  std::uint64_t *data() { return data_; }
+
+ private:
+  static const std::size_t LOCAL_WORDS = 40;
+
+  std::uint64_t local_[LOCAL_WORDS];
+  std::vector<std::uint64_t> heap_;
+  std::uint64_t *data_;
+};
+
+// For every byte value, the positions of the pattern holding it, 64 per
+// word. Patterns of up to 256 characters are kept inline.
+class pattern_bits {
+ public:
+  explicit pattern_bits(string_view pattern)
+      : size_(pattern.size()), words_((pattern.size() + 63) / 64),
+        stride_(std::max<std::size_t>(words_, 1)) {
+    if (stride_ > LOCAL_WORDS) {
+      heap_.assign(stride_ * 256, 0);
+    } else {
+      std::fill(local_.begin(), local_.begin() + stride_ * 256, 0);
+    }
+    std::uint64_t *bits = heap_.empty() ? local_.data() : heap_.data();
+    for (std::size_t i = 0; i < size_; i++) {
+      const unsigned char ch = static_cast<unsigned char>(pattern[i]);
+      bits[ch * stride_ + i / 64] |= std::uint64_t(1) << (i % 64);
+    }
+  }
+
+  std::size_t size() const { return size_; }
+
+  std::size_t words() const { return words_; }
+
+  std::uint64_t get(std::size_t word, char ch) const {
+    const std::size_t index =
+        static_cast<unsigned char>(ch) * stride_ + word;
+    return heap_.empty() ? local_[index] : heap_[index];
+  }
+
+ private:
+  static const std::size_t LOCAL_WORDS = 4;
+
+  std::size_t size_;
+  std::size_t words_;
+  std::size_t stride_;
+  std::array<std::uint64_t, 256 * LOCAL_WORDS> local_;
+  std::vector<std::uint64_t> heap_;
+};
+
+// Index of the lowest set bit of a non-zero word
+inline std::size_t lowestBit(std::uint64_t bits) {
+#if defined(__GNUC__)
+  return static_cast<std::size_t>(__builtin_ctzll(bits));
+#else
+  std::size_t i = 0;
+  for (; !(bits & 1); bits >>= 1) {
+    i++;
+  }
+  return i;
+#endif
+}
+
+inline std::size_t capDistance(std::size_t distance, std::size_t maxDistance) {
+  return distance > maxDistance ? maxDistance + 1 : distance;
+}
+
+inline std::size_t lengthGap(std::size_t a, std::size_t b) {
+  return a > b ? a - b : b - a;
+}
+
+// Hyyrö's block formulation of Myers' algorithm. With Transpositions set,
+// it computes the optimal string alignment distance, where a swap of two
+// adjacent characters counts as one edit.
+template <bool Transpositions>
+std::size_t bitParallelDistance(const pattern_bits &pm, string_view text,
+                                std::size_t maxDistance) {
+  const std::size_t words = pm.words();
+  const std::uint64_t last = std::uint64_t(1) << ((pm.size() - 1) % 64);
+  // Index 0 of each array is a zero sentinel for the word below word 0
+  word_buffer buffer(8 * (words + 1));
+  std::uint64_t *vectors[8];
+  for (int i = 0; i < 8; i++) {
+    vectors[i] = buffer.data() + i * (words + 1);
+  }
+  std::uint64_t *vp = vectors[0];
+  std::uint64_t *vn = vectors[1];
+  std::uint64_t *d0 = vectors[2];
+  std::uint64_t *pmOld = vectors[3];
+  std::uint64_t *vpNew = vectors[4];
+  std::uint64_t *vnNew = vectors[5];
+  std::uint64_t *d0New = vectors[6];
+  std::uint64_t *pmNew = vectors[7];
+  std::fill(vp + 1, vp + words + 1, ~std::uint64_t(0));
+
+  std::size_t score = pm.size();
+  for (std::size_t j = 0; j < text.size(); j++) {
+    std::uint64_t hpCarry = 1;
+    std::uint64_t hnCarry = 0;
+    for (std::size_t w = 1; w <= words; w++) {
+      const std::uint64_t pmj = pm.get(w - 1, text[j]);
+      std::uint64_t tr = 0;
+      if (Transpositions) {
+        tr = (((~d0[w] & pmj) << 1) | ((~d0[w - 1] & pmNew[w - 1]) >> 63)) &
+            pmOld[w];
+      }
+      const std::uint64_t x = pmj | hnCarry;
+      const std::uint64_t d = (((x & vp[w]) + vp[w]) ^ vp[w]) | x | vn[w] | tr;
+      std::uint64_t hp = vn[w] | ~(d | vp[w]);
+      std::uint64_t hn = d & vp[w];
+      if (w == words) {
+        score += (hp & last) != 0;
+        score -= (hn & last) != 0;
+      }
+      const std::uint64_t hpOut = hp >> 63;
+      const std::uint64_t hnOut = hn >> 63;
+      hp = (hp << 1) | hpCarry;
+      hn = (hn << 1) | hnCarry;
+      hpCarry = hpOut;
+      hnCarry = hnOut;
+      vpNew[w] = hn | ~(d | hp);
+      vnNew[w] = hp & d;
+      d0New[w] = d;
+      pmNew[w] = pmj;
+    }
+    std::swap(vp, vpNew);
+    std::swap(vn, vnNew);
+    std::swap(d0, d0New);
+    std::swap(pmOld, pmNew);
+    // Each remaining text character lowers the score by at most one
+    const std::size_t remaining = text.size() - j - 1;
+    if (score > remaining && score - remaining > maxDistance) {
+      return maxDistance + 1;
+    }
+  }
+  return capDistance(score, maxDistance);
+}
+
+// Drops the prefix and suffix a and b share, which cannot affect their
+// distance
+inline void removeCommonAffix(string_view &a, string_view &b) {
+  std::size_t prefix = 0;
+  const std::size_t shorter = std::min(a.size(), b.size());
+  while (prefix < shorter && a[prefix] == b[prefix]) {
+    prefix++;
+  }
+  a = a.substr(prefix);
+  b = b.substr(prefix);
+  std::size_t suffix = 0;
+  while (suffix < a.size() && suffix < b.size() &&
+         a[a.size() - 1 - suffix] == b[b.size() - 1 - suffix]) {
+    suffix++;
+  }
+  a = a.substr(0, a.size() - suffix);
+  b = b.substr(0, b.size() - suffix);
+}
+
+template <bool Transpositions>
+std::size_t editDistance(string_view a, string_view b,
+                         std::size_t maxDistance) {
+  removeCommonAffix(a, b);
+  if (a.size() < b.size()) {
+    std::swap(a, b);
+  }
+  if (a.size() - b.size() > maxDistance) {
+    return maxDistance + 1;
+  }
+  if (b.empty()) {
+    return a.size();
+  }
+  return bitParallelDistance<Transpositions>(pattern_bits(b), a,
+                                             maxDistance);
+}
+
+inline std::size_t commonPrefix(string_view a, string_view b,
+                                std::size_t limit) {
+  std::size_t i = 0;
+  while (i < limit && i < a.size() && i < b.size() && a[i] == b[i]) {
+    i++;
+  }
+  return i;
+}
+
+inline double jaroBound(std::size_t a, std::size_t b) {
+  const double matches = static_cast<double>(std::min(a, b));
+  return (matches / a + matches / b + 1.0) / 3.0;
+}
+
+// Jaro similarity of pattern and text. The unmatched pattern characters a
+// text character may pair with are found with one mask per word rather
+// than by scanning the match window.
+inline double jaroSimilarity(const pattern_bits &pm, string_view pattern,
+                             string_view text) {
+  if (pattern.empty() || text.empty()) {
+    return pattern.empty() && text.empty() ? 1.0 : 0.0;
+  }
+  const std::size_t longer = std::max(pattern.size(), text.size());
+  const std::size_t window = longer / 2 > 0 ? longer / 2 - 1 : 0;
+  const std::size_t textWords = (text.size() + 63) / 64;
+  word_buffer buffer(pm.words() + textWords);
+  std::uint64_t *patternMatched = buffer.data();
+  std::uint64_t *textMatched = buffer.data() + pm.words();
+
+  std::size_t matches = 0;
+  for (std::size_t j = 0; j < text.size(); j++) {
+    const std::size_t low = j > window ? j - window : 0;
+    if (low >= pattern.size()) {
+      break;
+    }
+    const std::size_t high = std::min(j + window, pattern.size() - 1);
+    for (std::size_t w = low / 64; w <= high / 64; w++) {
+      std::uint64_t range = ~std::uint64_t(0);
+      if (w == low / 64) {
+        range &= ~std::uint64_t(0) << (low % 64);
+      }
+      if (w == high / 64) {
+        range &= ~std::uint64_t(0) >> (63 - high % 64);
+      }
+      const std::uint64_t candidates =
+          pm.get(w, text[j]) & ~patternMatched[w] & range;
+      if (candidates != 0) {
+        patternMatched[w] |= candidates & (~candidates + 1);
+        textMatched[j / 64] |= std::uint64_t(1) << (j % 64);
+        matches++;
+        break;
+      }
+    }
+  }
+  if (matches == 0) {
+    return 0.0;
+  }
+
+  // Pair the matched characters of both strings up in order
+  std::size_t mismatched = 0;
+  std::size_t t = 0;
+  for (std::size_t w = 0; w < pm.words(); w++) {
+    for (std::uint64_t bits = patternMatched[w]; bits != 0;
+         bits &= bits - 1) {
+      const std::size_t i = w * 64 + lowestBit(bits);
+      while (!(textMatched[t / 64] >> (t % 64) & 1)) {
+        t++;
+      }
+      mismatched += pattern[i] != text[t];
+      t++;
+    }
+  }
+  const double m = static_cast<double>(matches);
+  return (m / pattern.size() + m / text.size() +
+          (m - mismatched / 2) / m) / 3.0;
+}
+
+// Winkler's adjustment: similarities above 0.7 are boosted by 0.1 for each
+// of up to four leading characters the strings share
+inline double winkler(double jaro, std::size_t prefix) {
+  return jaro > 0.7 ? jaro + prefix * 0.1 * (1.0 - jaro) : jaro;
+}
+
+inline double jaroWinklerSimilarity(const pattern_bits &pm,
+                                    string_view pattern, string_view text,
+                                    double minSimilarity) {
+  const std::size_t prefix = commonPrefix(pattern, text, 4);
+  if (minSimilarity > 0.0 &&
+      (pattern.empty() || text.empty() ||
+       winkler(jaroBound(pattern.size(), text.size()), prefix) <
+           minSimilarity)) {
+    return 0.0;
+  }
+  const double similarity =
+      winkler(jaroSimilarity(pm, pattern, text), prefix);
+  return similarity < minSimilarity ? 0.0 : similarity;
+}
+
+}  // namespace internal
+
+// Number of single-character insertions, deletions and substitutions that
+// turn a into b
+inline std::size_t levenshtein(string_view a, string_view b,
+                               std::size_t maxDistance = NO_LIMIT) {
+  return internal::editDistance<false>(a, b, maxDistance);
+}
+
+// Like levenshtein, but swapping two adjacent characters also counts as a
+// single edit. This is the restricted (optimal string alignment) form, in
+// which no substring is edited more than once.
+inline std::size_t damerauLevenshtein(string_view a, string_view b,
+                                      std::size_t maxDistance = NO_LIMIT) {
+  return internal::editDistance<true>(a, b, maxDistance);
+}
+
+// Similarity between 0 (nothing in common) and 1 (equal). Scores below
+// minSimilarity are reported as 0.
+inline double jaroWinkler(string_view a, string_view b,
+                          double minSimilarity = 0.0) {
+  return internal::jaroWinklerSimilarity(internal::pattern_bits(a), a, b,
+                                         minSimilarity);
+}
+
+// A string prepared for comparison against many others: the bit vectors
+// the algorithms need are built once, instead of on every call.
+class distance_query {
+ public:
+  explicit distance_query(string_view query)
+      : query_(query.data(), query.size()), bits_(query_) {}
+
+  const std::string &query() const { return query_; }
+
+  std::size_t levenshtein(string_view candidate,
+                          std::size_t maxDistance = NO_LIMIT) const {
+    return distance<false>(candidate, maxDistance);
+  }
+
+  std::size_t damerauLevenshtein(string_view candidate,
+                                 std::size_t maxDistance = NO_LIMIT) const {
+    return distance<true>(candidate, maxDistance);
+  }
+
+  double jaroWinkler(string_view candidate,
+                     double minSimilarity = 0.0) const {
+    return internal::jaroWinklerSimilarity(bits_, query_, candidate,
+                                           minSimilarity);
+  }
+
+ private:
+  template <bool Transpositions>
+  std::size_t distance(string_view candidate, std::size_t maxDistance) const {
+    if (internal::lengthGap(query_.size(), candidate.size()) > maxDistance) {
+      return maxDistance + 1;
+    }
+    if (query_.empty()) {
+      return candidate.size();
+    }
+    return internal::bitParallelDistance<Transpositions>(bits_, candidate,
+                                                         maxDistance);
+  }
+
+  std::string query_;
+  internal::pattern_bits bits_;
+};
+
+// Batch forms: score query against every string of candidates, in order
+template <typename Range>
+std::vector<std::size_t> levenshtein(const distance_query &query,
+                                     const Range &candidates,
+                                     std::size_t maxDistance = NO_LIMIT) {
+  std::vector<std::size_t> distances;
+  for (const auto &candidate : candidates) {
+    distances.push_back(query.levenshtein(candidate, maxDistance));
+  }
+  return distances;
+}
+
+template <typename Range>
+std::vector<std::size_t> damerauLevenshtein(
+    const distance_query &query, const Range &candidates,
+    std::size_t maxDistance = NO_LIMIT) {
+  std::vector<std::size_t> distances;
+  for (const auto &candidate : candidates) {
+    distances.push_back(query.damerauLevenshtein(candidate, maxDistance));
+  }
+  return distances;
+}
+
+template <typename Range>
+std::vector<double> jaroWinkler(const distance_query &query,
+                                const Range &candidates,
+                                double minSimilarity = 0.0) {
+  std::vector<double> similarities;
+  for (const auto &candidate : candidates) {
+    similarities.push_back(query.jaroWinkler(candidate, minSimilarity));
+  }
+  return similarities;
+}
+
+}  // namespace string
+
+}  // namespace util
+
+#endif  // INCLUDE_UTIL_STRING_DISTANCE_HPP_
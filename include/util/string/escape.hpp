@@ -0,0 +1,467 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_ESCAPE_HPP_
+#define INCLUDE_UTIL_STRING_ESCAPE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include "util/string/simd.hpp"
+#include "util/string/string_view.hpp"
+
+namespace util {
+
+namespace string {
+
+// Single-pass encoders and decoders for JSON strings, URL percent-encoding
+// and C string literals. The encoders scan for the next character that
+// needs escaping 16 bytes at a time with SSE2 and append the clean run in
+// between with one call. Every function has a form that appends to an
+// existing buffer, so a response can be built without temporaries.
+// Decoders throw std::invalid_argument on malformed input and then leave
+// the buffer they append to unchanged.
+namespace internal {
+
+static const char HEX_DIGITS[] = "0123456789ABCDEF";
+
+inline int hexValue(const char ch) {
+  if (ch >= '0' && ch <= '9') {
+    return ch - '0';
+  } else if (ch >= 'a' && ch <= 'f') {
+    return ch - 'a' + 10;
+  } else if (ch >= 'A' && ch <= 'F') {
+    return ch - 'A' + 10;
+  }
+  return -1;
+}
+
+// Returns the offset of the first byte that is a control character, a
+// quote or a backslash, or length if there is none.
+inline std::size_t findJsonSpecial(const char *s, std::size_t length) {
+  std::size_t i = 0;
+#ifdef UTIL_STRING_HAVE_SSE2
+  for (; i + 16 <= length; i += 16) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+    __m128i special = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('"')),
+                     _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\'))),
+        inRange(chunk, 0x00, 0x1F));
+    int mask = _mm_movemask_epi8(special);
+    if (mask != 0) {
+      return i + __builtin_ctz(static_cast<unsigned>(mask));
+    }
+  }
+#endif
+  for (; i < length; i++) {
+    const unsigned char ch = static_cast<unsigned char>(s[i]);
+    if (ch < 0x20 || ch == '"' || ch == '\\') {
+      break;
+    }
+  }
+  return i;
+}
+
+inline bool isUrlSafe(const char ch) {
+  return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') ||
+      (ch >= '0' && ch <= '9') || ch == '-' || ch == '.' || ch == '_' ||
+      ch == '~';
+}
+
+// Returns the offset of the first byte outside the unreserved set of
+// RFC 3986, or length if there is none.
+inline std::size_t findUrlUnsafe(const char *s, std::size_t length) {
+  std::size_t i = 0;
+#ifdef UTIL_STRING_HAVE_SSE2
+  for (; i + 16 <= length; i += 16) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+    __m128i safe = _mm_or_si128(
+        _mm_or_si128(inRange(chunk, 'a', 'z'), inRange(chunk, 'A', 'Z')),
+        _mm_or_si128(inRange(chunk, '-', '.'), inRange(chunk, '0', '9')));
+    safe = _mm_or_si128(
+        safe, _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('_')),
+                           _mm_cmpeq_epi8(chunk, _mm_set1_epi8('~'))));
+    unsigned mask = ~static_cast<unsigned>(_mm_movemask_epi8(safe)) & 0xFFFF;
+    if (mask != 0) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+#endif
+  for (; i < length; i++) {
+    if (!isUrlSafe(s[i])) {
+      break;
+    }
+  }
+  return i;
+}
+
+// Returns the offset of the first byte that a C string literal cannot hold
+// as is: control characters, DEL, quotes and backslashes.
+inline std::size_t findCSpecial(const char *s, std::size_t length) {
+  std::size_t i = 0;
+#ifdef UTIL_STRING_HAVE_SSE2
+  for (; i + 16 <= length; i += 16) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+    __m128i special = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('"')),
+                     _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\'))),
+        _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\'')),
+                     _mm_cmpeq_epi8(chunk, _mm_set1_epi8(0x7F))));
+    special = _mm_or_si128(special, inRange(chunk, 0x00, 0x1F));
+    int mask = _mm_movemask_epi8(special);
+    if (mask != 0) {
+      return i + __builtin_ctz(static_cast<unsigned>(mask));
+    }
+  }
+#endif
+  for (; i < length; i++) {
+    const unsigned char ch = static_cast<unsigned char>(s[i]);
+    if (ch < 0x20 || ch == 0x7F || ch == '"' || ch == '\\' || ch == '\'') {
+      break;
+    }
+  }
+  return i;
+}
+
+// Appends the clean runs of s found by find, and escape(ch, out) for the
+// characters in between.
+template <typename Find, typename Escape>
+inline void escapeRuns(string_view s, std::string &out, Find find,
+                       Escape escape) {
+  out.reserve(out.size() + s.size());
+  const char *p = s.data();
+  const char *end = p + s.size();
+  while (p != end) {
+    std::size_t clean = find(p, end - p);
+    out.append(p, clean);
+    p += clean;
+    if (p == end) {
+      break;
+    }
+    escape(*p++, out);
+  }
+}
+
+inline void appendUtf8(std::uint32_t cp, std::string &out) {
+  if (cp < 0x80) {
+    out.push_back(static_cast<char>(cp));
+  } else if (cp < 0x800) {
+    out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+    out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+  } else if (cp < 0x10000) {
+    out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+    out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+  } else {
+    out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+    out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+  }
+}
+
+inline std::uint32_t readHex4(const char *p, const char *end) {
+  if (end - p < 4) {
+    throw std::invalid_argument("truncated \\u escape");
+  }
+  std::uint32_t value = 0;
+  for (int i = 0; i < 4; i++) {
+    int digit = hexValue(p[i]);
+    if (digit < 0) {
+      throw std::invalid_argument("invalid \\u escape");
+    }
+    value = (value << 4) | static_cast<std::uint32_t>(digit);
+  }
+  return value;
+}
+
+// Cuts out back to the size it had when constructed, unless committed, so
+// that a decoder which throws leaves out as it found it
+class rollback {
+ public:
+  explicit rollback(std::string &out)
+      : out_(out), size_(out.size()), committed_(false) {
+  }
+
+  ~rollback() {
+    if (!committed_) {
+      out_.resize(size_);
+    }
+  }
+
+  rollback(const rollback &) = delete;
+  rollback &operator=(const rollback &) = delete;
+
+  void commit() {
+    committed_ = true;
+  }
+
+ private:
+  std::string &out_;
+  std::size_t size_;
+  bool committed_;
+};
+
+}  // namespace internal
+
+// Escapes s for use inside a JSON string literal (without the enclosing
+// quotes). Non-ASCII bytes are copied as they are.
+inline void escapeJson(string_view s, std::string &out) {
+  internal::escapeRuns(s, out, internal::findJsonSpecial,
+                       [](const char ch, std::string &o) {
+    switch (ch) {
+      case '"': o.append("\\\""); break;
+      case '\\': o.append("\\\\"); break;
+      case '\b': o.append("\\b"); break;
+      case '\f': o.append("\\f"); break;
+      case '\n': o.append("\\n"); break;
+      case '\r': o.append("\\r"); break;
+      case '\t': o.append("\\t"); break;
+      default:
+        o.append("\\u00");
+        o.push_back(internal::HEX_DIGITS[(ch >> 4) & 0xF]);
+        o.push_back(internal::HEX_DIGITS[ch & 0xF]);
+    }
+  });
+}
+
+inline std::string escapeJson(string_view s) {
+  std::string out;
+  escapeJson(s, out);
+  return out;
+}
+
+// Resolves the escapes of a JSON string literal body, including \u
+// escapes and surrogate pairs, which are written out as UTF-8.
+inline void unescapeJson(string_view s, std::string &out) {
+  out.reserve(out.size() + s.size());
+  internal::rollback guard(out);
+  const char *p = s.data();
+  const char *end = p + s.size();
+  while (p != end) {
+    const char *backslash = std::char_traits<char>::find(p, end - p, '\\');
+    const char *run = backslash ? backslash : end;
+    out.append(p, run);
+    p = run;
+    if (p == end) {
+      break;
+    }
+    if (++p == end) {
+      throw std::invalid_argument("trailing backslash");
+    }
+    switch (*p++) {
+      case '"': out.push_back('"'); break;
+      case '\\': out.push_back('\\'); break;
+      case '/': out.push_back('/'); break;
+      case 'b': out.push_back('\b'); break;
+      case 'f': out.push_back('\f'); break;
+      case 'n': out.push_back('\n'); break;
+      case 'r': out.push_back('\r'); break;
+      case 't': out.push_back('\t'); break;
+      case 'u': {
+        std::uint32_t cp = internal::readHex4(p, end);
+        p += 4;
+        if (cp >= 0xD800 && cp <= 0xDBFF) {
+          if (end - p < 2 || p[0] != '\\' || p[1] != 'u') {
+            throw std::invalid_argument("unpaired surrogate");
+          }
+          std::uint32_t low = internal::readHex4(p + 2, end);
+          if (low < 0xDC00 || low > 0xDFFF) {
+            throw std::invalid_argument("unpaired surrogate");
+          }
+          cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+          p += 6;
+        } else if (cp >= 0xDC00 && cp <= 0xDFFF) {
+          throw std::invalid_argument("unpaired surrogate");
+        }
+        internal::appendUtf8(cp, out);
+        break;
+      }
+      default:
+        throw std::invalid_argument("invalid escape sequence");
+    }
+  }
+  guard.commit();
+}
+
+inline std::string unescapeJson(string_view s) {
+  std::string out;
+  unescapeJson(s, out);
+  return out;
+}
+
+// Percent-encodes every byte outside the unreserved set of RFC 3986
+inline void escapeUrl(string_view s, std::string &out) {
+  internal::escapeRuns(s, out, internal::findUrlUnsafe,
+                       [](const char ch, std::string &o) {
+    o.push_back('%');
+    o.push_back(internal::HEX_DIGITS[(ch >> 4) & 0xF]);
+    o.push_back(internal::HEX_DIGITS[ch & 0xF]);
+  });
+}
+
+inline std::string escapeUrl(string_view s) {
+  std::string out;
+  escapeUrl(s, out);
+  return out;
+}
+
+// Decodes %XX sequences. '+' is left alone, as it only means a space in
+// form encoding.
+inline void unescapeUrl(string_view s, std::string &out) {
+  out.reserve(out.size() + s.size());
+  internal::rollback guard(out);
+  const char *p = s.data();
+  const char *end = p + s.size();
+  while (p != end) {
+    const char *percent = std::char_traits<char>::find(p, end - p, '%');
+    const char *run = percent ? percent : end;
+    out.append(p, run);
+    p = run;
+    if (p == end) {
+      break;
+    }
+    int high = end - p >= 3 ? internal::hexValue(p[1]) : -1;
+    int low = end - p >= 3 ? internal::hexValue(p[2]) : -1;
+    if (high < 0 || low < 0) {
+      throw std::invalid_argument("invalid percent-encoding");
+    }
+    out.push_back(static_cast<char>((high << 4) | low));
+    p += 3;
+  }
+  guard.commit();
+}
+
+inline std::string unescapeUrl(string_view s) {
+  std::string out;
+  unescapeUrl(s, out);
+  return out;
+}
+
+// Escapes s for use inside a C string or character literal. Control
+// characters without a short form are written as three-digit octal, which
+// unlike \x cannot swallow a following digit. Non-ASCII bytes are copied.
+inline void escapeC(string_view s, std::string &out) {
+  internal::escapeRuns(s, out, internal::findCSpecial,
+                       [](const char ch, std::string &o) {
+    switch (ch) {
+      case '"': o.append("\\\""); break;
+      case '\'': o.append("\\'"); break;
+      case '\\': o.append("\\\\"); break;
+      case '\a': o.append("\\a"); break;
+      case '\b': o.append("\\b"); break;
+      case '\f': o.append("\\f"); break;
+      case '\n': o.append("\\n"); break;
+      case '\r': o.append("\\r"); break;
+      case '\t': o.append("\\t"); break;
+      case '\v': o.append("\\v"); break;
+      default: {
+        const unsigned char byte = static_cast<unsigned char>(ch);
+        o.push_back('\\');
+        o.push_back(static_cast<char>('0' + (byte >> 6)));
+        o.push_back(static_cast<char>('0' + ((byte >> 3) & 7)));
+        o.push_back(static_cast<char>('0' + (byte & 7)));
+      }
+    }
+  });
+}
+
+inline std::string escapeC(string_view s) {
+  std::string out;
+  escapeC(s, out);
+  return out;
+}
+
+// Resolves the simple escapes, octal escapes of up to three digits and
+// hexadecimal escapes of up to two digits of a C literal.
+inline void unescapeC(string_view s, std::string &out) {
+  out.reserve(out.size() + s.size());
+  internal::rollback guard(out);
+  const char *p = s.data();
+  const char *end = p + s.size();
+  while (p != end) {
+    const char *backslash = std::char_traits<char>::find(p, end - p, '\\');
+    const char *run = backslash ? backslash : end;
+    out.append(p, run);
+    p = run;
+    if (p == end) {
+      break;
+    }
+    if (++p == end) {
+      throw std::invalid_argument("trailing backslash");
+    }
+    const char ch = *p++;
+    switch (ch) {
+      case '"': case '\'': case '\\': case '?': out.push_back(ch); break;
+      case 'a': out.push_back('\a'); break;
+      case 'b': out.push_back('\b'); break;
+      case 'f': out.push_back('\f'); break;
+      case 'n': out.push_back('\n'); break;
+      case 'r': out.push_back('\r'); break;
+      case 't': out.push_back('\t'); break;
+      case 'v': out.push_back('\v'); break;
+      case 'x': {
+        int value = 0;
+        int digits = 0;
+        for (; digits < 2 && p != end && internal::hexValue(*p) >= 0; p++) {
+          value = (value << 4) | internal::hexValue(*p);
+          digits++;
+        }
+        if (digits == 0) {
+          throw std::invalid_argument("invalid \\x escape");
+        }
+        out.push_back(static_cast<char>(value));
+        break;
+      }
+      default: {
+        if (ch < '0' || ch > '7') {
+          throw std::invalid_argument("invalid escape sequence");
+        }
+        int value = ch - '0';
+        for (int digits = 1; digits < 3 && p != end && *p >= '0' && *p <= '7';
+             digits++) {
+          value = (value << 3) | (*p++ - '0');
+        }
+        if (value > 0xFF) {
+          throw std::invalid_argument("octal escape out of range");
+        }
+        out.push_back(static_cast<char>(value));
+      }
+    }
+  }
+  guard.commit();
+}
+
+inline std::string unescapeC(string_view s) {
+  std::string out;
+  unescapeC(s, out);
+  return out;
+}
+
+}  // namespace string
+
+}  // namespace util
+
+#endif  // INCLUDE_UTIL_STRING_ESCAPE_HPP_
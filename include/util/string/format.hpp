@@ -0,0 +1,125 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_FORMAT_HPP_
+#define INCLUDE_UTIL_STRING_FORMAT_HPP_
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cwchar>
+#include <stdexcept>
+#include <string>
+#include "util/string/probe.hpp"
+#include "util/string/scratch.hpp"
+
+namespace util {
+
+namespace string {
+
+namespace internal {
+
+template <typename T>
+inline T to_const(const T& data) {
+  return data;
+}
+
+template <typename T>
+inline const T* to_const(const T* data) {
+  return data;
+}
+
+template <typename T>
+inline const T * to_const(const std::basic_string<T> &data) {
+  return data.c_str();
+}
+
+}  // namespace internal
+
+// Throws std::invalid_argument if the output cannot be produced, e.g. for
+// an argument that does not convert to the output's character type
+template <typename ... Args>
+inline std::basic_string<char> format(const char *fmt, const Args& ... args) {
+  UTIL_STRING_PROBE(Format, 0);
+  int length = std::snprintf(nullptr, 0, fmt, internal::to_const(args) ...);
+  if (length < 0) {
+    throw std::invalid_argument("invalid format or argument");
+  }
+  UTIL_STRING_PROBE_BYTES(length);
+  std::size_t size = static_cast<std::size_t>(length) + 1;
+  scratch::buffer<char> buf(size);
+  std::snprintf(buf.data(), size, fmt, internal::to_const(args) ...);
+  return UTIL_STRING_PROBE_RETURN(std::basic_string<char>(buf.data(),
+                                                          size - 1));
+}
+
+template <typename ... Args>
+inline std::basic_string<char> format(const std::basic_string<char> &fmt,
+                                      const Args& ... args) {
+  return format(fmt.c_str(), args ...);
+}
+
+// Throws std::invalid_argument as above, and for output longer than 1M
+// characters
+template <typename ... Args>
+inline std::basic_string<wchar_t> format(const wchar_t *fmt,
+                                         const Args& ... args) {
+  // swprintf cannot predict the required size and fails the same way for
+  // a short buffer as for bad input, so grow the buffer until the output
+  // fits, unless errno tells that the failure was not a truncation
+  UTIL_STRING_PROBE(Format, 0);
+  const std::size_t MAX_SIZE = 1024 * 1024;
+  scratch::buffer<wchar_t> buf(256);
+  int size;
+  while (true) {
+    errno = 0;
+    size = std::swprintf(buf.data(), buf.size(), fmt,
+                         internal::to_const(args) ...);
+    if (size >= 0) {
+      break;
+    }
+    if (errno == EILSEQ || errno == EINVAL) {
+      throw std::invalid_argument("invalid format or argument");
+    }
+    if (buf.size() >= MAX_SIZE) {
+      throw std::invalid_argument("format output too long or invalid");
+    }
+    buf.resize(buf.size() * 2);
+  }
+  UTIL_STRING_PROBE_BYTES(size * sizeof(wchar_t));
+  return UTIL_STRING_PROBE_RETURN(std::basic_string<wchar_t>(buf.data(),
+                                                             size));
+}
+
+template <typename ... Args>
+inline std::basic_string<wchar_t> format(const std::basic_string<wchar_t> &fmt,
+                                         const Args& ... args) {
+  return format(fmt.c_str(), args ...);
+}
+
+}  // namespace string
+
+}  // namespace util
+
+#endif  // INCLUDE_UTIL_STRING_FORMAT_HPP_
@@ -0,0 +1,393 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_GLOB_HPP_
+#define INCLUDE_UTIL_STRING_GLOB_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cwctype>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "util/string/string_view.hpp"
+
+namespace util {
+
+namespace string {
+
+enum class Case { Sensitive, Insensitive };
+
+namespace internal {
+
+inline char foldCase(const char ch) {
+  return (ch >= 'A' && ch <= 'Z') ? static_cast<char>(ch + 0x20) : ch;
+}
+
+inline wchar_t foldCase(const wchar_t ch) {
+  return static_cast<wchar_t>(std::towlower(ch));
+}
+
+}  // namespace internal
+
+// A wildcard pattern compiled once and matched many times:
+//
+//   *       any run of characters, including an empty one
+//   ?       any single character
+//   [abc]   one of the listed characters; ranges such as [a-z] and negated
+//           classes [!a-z] or [^a-z] are supported
+//   \c      the character c itself
+//
+// The pattern is split at each * into fixed-length segments. The first and
+// last segments are anchored at the ends of the input like startsWith and
+// endsWith, and the ones in between are found left to right like contains,
+// which is enough for a glob and never backtracks. Inner segments of plain
+// characters are found with Knuth-Morris-Pratt, in O(n + m) for n input and
+// m segment characters. The others, with ? or classes or matched without
+// case, run a bit-parallel shift-and in O(n * ceil(m / 64)); the code units
+// below 256 are classified by table, any other costs O(m) to classify.
+// Case-insensitive matching folds ASCII letters for char and uses towlower
+// for wchar_t.
+//
+// Throws std::invalid_argument for an unterminated class or a trailing
+// backslash.
+template <typename T>
+class basic_glob {
+ public:
+  explicit basic_glob(basic_string_view<T> pattern,
+                      Case sensitivity = Case::Sensitive)
+      : fold_(sensitivity == Case::Insensitive), leading_(false),
+        trailing_(false) {
+    compile(pattern);
+  }
+
+  bool match(basic_string_view<T> s) const {
+    if (segments_.size() == 1 && !leading_ && !trailing_) {
+      return s.size() == segments_[0].length && matchAt(segments_[0], s, 0);
+    }
+    std::size_t first = 0;
+    std::size_t last = segments_.size();
+    std::size_t position = 0;
+    std::size_t limit = s.size();
+    if (!leading_) {
+      const segment &head = segments_[first++];
+      if (head.length > s.size() || !matchAt(head, s, 0)) {
+        return false;
+      }
+      position = head.length;
+    }
+    if (!trailing_ && first < last) {
+      const segment &tail = segments_[--last];
+      if (tail.length > limit - position ||
+          !matchAt(tail, s, limit - tail.length)) {
+        return false;
+      }
+      limit -= tail.length;
+    }
+    for (std::size_t i = first; i < last; i++) {
+      std::size_t found = find(segments_[i], s, position, limit);
+      if (found == basic_string_view<T>::npos) {
+        return false;
+      }
+      position = found + segments_[i].length;
+    }
+    return true;
+  }
+
+  bool operator()(basic_string_view<T> s) const {
+    return match(s);
+  }
+
+ private:
+  enum class Kind { Literal, Any, Class };
+
+  struct element {
+    Kind kind;
+    T ch;
+    std::size_t klass;
+  };
+
+  struct char_class {
+    bool negated;
+    std::vector<std::pair<T, T>> ranges;
+  };
+
+  // Elements [begin, begin + length) of elements_. literal holds them as a
+  // string when they are all plain characters, and fail is its
+  // Knuth-Morris-Pratt failure function. Otherwise masks[c * words + w] has
+  // bit i set when element 64 * w + i matches the code unit c < 256.
+  struct segment {
+    std::size_t begin;
+    std::size_t length;
+    bool plain;
+    std::basic_string<T> literal;
+    std::vector<std::size_t> fail;
+    std::vector<std::uint64_t> masks;
+
+    std::size_t words() const {
+      return (length + 63) / 64;
+    }
+  };
+
+  T fold(const T ch) const {
+    return fold_ ? internal::foldCase(ch) : ch;
+  }
+
+  void compile(basic_string_view<T> pattern) {
+    segments_.push_back(segment{0, 0, true, std::basic_string<T>(), {}, {}});
+    for (std::size_t i = 0; i < pattern.size(); i++) {
+      const T ch = pattern[i];
+      if (ch == T('*')) {
+        if (i == 0) {
+          leading_ = true;
+        }
+        if (i + 1 == pattern.size()) {
+          trailing_ = true;
+        }
+        if (segments_.back().length > 0) {
+          segments_.push_back(segment{elements_.size(), 0, true,
+                                      std::basic_string<T>(), {}, {}});
+        }
+        continue;
+      }
+      element e{Kind::Literal, ch, 0};
+      if (ch == T('?')) {
+        e.kind = Kind::Any;
+      } else if (ch == T('[')) {
+        e.kind = Kind::Class;
+        e.klass = classes_.size();
+        i = compileClass(pattern, i + 1);
+      } else if (ch == T('\\')) {
+        if (++i == pattern.size()) {
+          throw std::invalid_argument("trailing backslash in pattern");
+        }
+        e.ch = pattern[i];
+      }
+      segment &current = segments_.back();
+      if (e.kind == Kind::Literal) {
+        e.ch = fold(e.ch);
+        current.literal.push_back(e.ch);
+      } else {
+        current.plain = false;
+      }
+      elements_.push_back(e);
+      current.length++;
+    }
+    if (segments_.size() > 1 && segments_.back().length == 0) {
+      segments_.pop_back();
+    }
+    for (auto &seg : segments_) {
+      if (seg.length == 0) {
+        continue;
+      }
+      if (seg.plain && !fold_) {
+        const std::basic_string<T> &literal = seg.literal;
+        seg.fail.assign(literal.size(), 0);
+        for (std::size_t i = 1, k = 0; i < literal.size(); i++) {
+          while (k > 0 && literal[i] != literal[k]) {
+            k = seg.fail[k - 1];
+          }
+          if (literal[i] == literal[k]) {
+            k++;
+          }
+          seg.fail[i] = k;
+        }
+        continue;
+      }
+      const std::size_t words = seg.words();
+      seg.masks.resize(256 * words);
+      for (std::size_t c = 0; c < 256; c++) {
+        for (std::size_t w = 0; w < words; w++) {
+          seg.masks[c * words + w] = mask(seg, static_cast<T>(c), w);
+        }
+      }
+    }
+  }
+
+  // Parses the class starting after '[' and returns the index of its ']'
+  std::size_t compileClass(basic_string_view<T> pattern, std::size_t i) {
+    char_class klass;
+    klass.negated = i < pattern.size() &&
+        (pattern[i] == T('!') || pattern[i] == T('^'));
+    if (klass.negated) {
+      i++;
+    }
+    std::size_t start = i;
+    for (; i < pattern.size(); i++) {
+      T low = pattern[i];
+      if (low == T(']') && i != start) {
+        classes_.push_back(klass);
+        return i;
+      }
+      if (low == T('\\') && i + 1 < pattern.size()) {
+        low = pattern[++i];
+      }
+      T high = low;
+      if (i + 2 < pattern.size() && pattern[i + 1] == T('-') &&
+          pattern[i + 2] != T(']')) {
+        high = pattern[i + 2];
+        i += 2;
+      }
+      klass.ranges.push_back(std::make_pair(low, high));
+    }
+    throw std::invalid_argument("unterminated character class in pattern");
+  }
+
+  bool inClass(const char_class &klass, const T ch) const {
+    for (const auto &range : klass.ranges) {
+      if ((ch >= range.first && ch <= range.second) ||
+          (fold_ && fold(ch) >= fold(range.first) &&
+           fold(ch) <= fold(range.second))) {
+        return !klass.negated;
+      }
+    }
+    return klass.negated;
+  }
+
+  bool matches(const element &e, const T ch) const {
+    return (e.kind == Kind::Any) ||
+        (e.kind == Kind::Literal && fold(ch) == e.ch) ||
+        (e.kind == Kind::Class && inClass(classes_[e.klass], ch));
+  }
+
+  // The elements [64 * word, 64 * word + 64) of seg that match ch, as bits
+  std::uint64_t mask(const segment &seg, const T ch, std::size_t word) const {
+    std::uint64_t bits = 0;
+    const std::size_t end = std::min(seg.length, 64 * word + 64);
+    for (std::size_t i = 64 * word; i < end; i++) {
+      if (matches(elements_[seg.begin + i], ch)) {
+        bits |= std::uint64_t(1) << (i % 64);
+      }
+    }
+    return bits;
+  }
+
+  bool matchAt(const segment &seg, basic_string_view<T> s,
+               std::size_t offset) const {
+    for (std::size_t i = 0; i < seg.length; i++) {
+      if (!matches(elements_[seg.begin + i], s[offset + i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::size_t find(const segment &seg, basic_string_view<T> s,
+                   std::size_t position, std::size_t limit) const {
+    if (seg.length > limit - position) {
+      return basic_string_view<T>::npos;
+    }
+    if (seg.length == 0) {
+      return position;
+    }
+    return seg.masks.empty() ? findLiteral(seg, s, position, limit)
+                             : findShiftAnd(seg, s, position, limit);
+  }
+
+  // Knuth-Morris-Pratt, skipping to the next candidate first character
+  // with char_traits::find whenever nothing is matched
+  std::size_t findLiteral(const segment &seg, basic_string_view<T> s,
+                          std::size_t position, std::size_t limit) const {
+    const std::basic_string<T> &literal = seg.literal;
+    const T *text = s.data();
+    std::size_t matched = 0;
+    for (std::size_t i = position; i < limit; i++) {
+      if (matched == 0) {
+        const T *found = std::char_traits<T>::find(text + i, limit - i,
+                                                   literal[0]);
+        if (found == nullptr) {
+          break;
+        }
+        i = found - text;
+      }
+      while (matched > 0 && text[i] != literal[matched]) {
+        matched = seg.fail[matched - 1];
+      }
+      if (text[i] == literal[matched] && ++matched == literal.size()) {
+        return i + 1 - literal.size();
+      }
+    }
+    return basic_string_view<T>::npos;
+  }
+
+  // Bit i of the state is set when elements [0, i] of seg match the input
+  // ending at the current position; it spans words() words.
+  std::size_t findShiftAnd(const segment &seg, basic_string_view<T> s,
+                           std::size_t position, std::size_t limit) const {
+    const std::size_t words = seg.words();
+    const std::uint64_t last = std::uint64_t(1) << ((seg.length - 1) % 64);
+    std::uint64_t local[4] = {};
+    std::vector<std::uint64_t> heap;
+    std::uint64_t *state = local;
+    if (words > 4) {
+      heap.assign(words, 0);
+      state = heap.data();
+    }
+    for (std::size_t i = position; i < limit; i++) {
+      const auto unit = static_cast<typename std::make_unsigned<T>::type>(
+          s[i]);
+      std::uint64_t carry = 1;
+      for (std::size_t w = 0; w < words; w++) {
+        const std::uint64_t bits = unit < 256 ? seg.masks[unit * words + w]
+                                              : mask(seg, s[i], w);
+        const std::uint64_t next = ((state[w] << 1) | carry) & bits;
+        carry = state[w] >> 63;
+        state[w] = next;
+      }
+      if (state[words - 1] & last) {
+        return i + 1 - seg.length;
+      }
+    }
+    return basic_string_view<T>::npos;
+  }
+
+  bool fold_;
+  bool leading_;
+  bool trailing_;
+  std::vector<element> elements_;
+  std::vector<char_class> classes_;
+  std::vector<segment> segments_;
+};
+
+typedef basic_glob<char> glob;
+typedef basic_glob<wchar_t> wglob;
+
+inline bool match(string_view pattern, string_view s,
+                  Case sensitivity = Case::Sensitive) {
+  return glob(pattern, sensitivity).match(s);
+}
+
+inline bool match(wstring_view pattern, wstring_view s,
+                  Case sensitivity = Case::Sensitive) {
+  return wglob(pattern, sensitivity).match(s);
+}
+
+}  // namespace string
+
+}  // namespace util
+
+#endif  // INCLUDE_UTIL_STRING_GLOB_HPP_
@@ -0,0 +1,279 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_HASH_HPP_
+#define INCLUDE_UTIL_STRING_HASH_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include "util/string/string_view.hpp"
+
+namespace util {
+
+namespace string {
+
+namespace internal {
+
+// The wyhash construction: 64x64->128 bit multiplications folded back to
+// 64 bits. Reads go through a Reader so that the case-insensitive variant
+// can fold each word as it is loaded, instead of hashing a lowered copy.
+inline void multiply(std::uint64_t &a, std::uint64_t &b) {
+#ifdef __SIZEOF_INT128__
+  unsigned __int128 r = a;
+  r *= b;
+  a = static_cast<std::uint64_t>(r);
+  b = static_cast<std::uint64_t>(r >> 64);
+#else
+  std::uint64_t ha = a >> 32, hb = b >> 32;
+  std::uint64_t la = static_cast<std::uint32_t>(a);
+  std::uint64_t lb = static_cast<std::uint32_t>(b);
+  std::uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+  std::uint64_t t = rl + (rm0 << 32);
+  std::uint64_t c = t < rl;
+  std::uint64_t lo = t + (rm1 << 32);
+  c += lo < t;
+  a = lo;
+  b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+inline std::uint64_t mix(std::uint64_t a, std::uint64_t b) {
+  multiply(a, b);
+  return a ^ b;
+}
+
+struct raw_reader {
+  static std::uint64_t r8(const unsigned char *p) {
+    std::uint64_t v;
+    std::memcpy(&v, p, 8);
+    return v;
+  }
+
+  static std::uint64_t r4(const unsigned char *p) {
+    std::uint32_t v;
+    std::memcpy(&v, p, 4);
+    return v;
+  }
+
+  static std::uint64_t r1(const unsigned char *p) {
+    return *p;
+  }
+};
+
+// Lowers the ASCII letters of every byte in a word at once. Bytes with the
+// high bit set are left alone, so UTF-8 sequences pass through unchanged.
+struct ascii_fold_reader {
+  static std::uint64_t fold(std::uint64_t w, std::uint64_t ones) {
+    const std::uint64_t high = ones * 0x80;
+    std::uint64_t heptets = w & (ones * 0x7F);
+    std::uint64_t aboveA = heptets + ones * (0x80 - 'A');
+    std::uint64_t aboveZ = heptets + ones * (0x80 - 'Z' - 1);
+    std::uint64_t upper = (aboveA ^ aboveZ) & ~w & high;
+    return w | (upper >> 2);
+  }
+
+  static std::uint64_t r8(const unsigned char *p) {
+    return fold(raw_reader::r8(p), 0x0101010101010101ULL);
+  }
+
+  static std::uint64_t r4(const unsigned char *p) {
+    return fold(raw_reader::r4(p), 0x01010101ULL);
+  }
+
+  static std::uint64_t r1(const unsigned char *p) {
+    return fold(*p, 0x01);
+  }
+};
+
+template <typename Reader>
+inline std::uint64_t wyhash(const void *key, std::size_t length,
+                            std::uint64_t seed) {
+  static const std::uint64_t secret[4] = {
+    0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL,
+    0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL
+  };
+  auto p = static_cast<const unsigned char *>(key);
+  seed ^= mix(seed ^ secret[0], secret[1]);
+  std::uint64_t a;
+  std::uint64_t b;
+  if (length <= 16) {
+    if (length >= 4) {
+      const std::size_t skip = (length >> 3) << 2;
+      a = (Reader::r4(p) << 32) | Reader::r4(p + skip);
+      b = (Reader::r4(p + length - 4) << 32) |
+          Reader::r4(p + length - 4 - skip);
+    } else if (length > 0) {
+      a = (Reader::r1(p) << 16) | (Reader::r1(p + (length >> 1)) << 8) |
+          Reader::r1(p + length - 1);
+      b = 0;
+    } else {
+      a = b = 0;
+    }
+  } else {
+    std::size_t i = length;
+    if (i > 48) {
+      std::uint64_t see1 = seed;
+      std::uint64_t see2 = seed;
+      do {
+        seed = mix(Reader::r8(p) ^ secret[1], Reader::r8(p + 8) ^ seed);
+        see1 = mix(Reader::r8(p + 16) ^ secret[2], Reader::r8(p + 24) ^ see1);
+        see2 = mix(Reader::r8(p + 32) ^ secret[3], Reader::r8(p + 40) ^ see2);
+        p += 48;
+        i -= 48;
+      } while (i > 48);
+      seed ^= see1 ^ see2;
+    }
+    while (i > 16) {
+      seed = mix(Reader::r8(p) ^ secret[1], Reader::r8(p + 8) ^ seed);
+      i -= 16;
+      p += 16;
+    }
+    a = Reader::r8(p + i - 16);
+    b = Reader::r8(p + i - 8);
+  }
+  a ^= secret[1];
+  b ^= seed;
+  multiply(a, b);
+  return mix(a ^ secret[0] ^ length, b ^ secret[1]);
+}
+
+inline bool equalsIgnoreCase(string_view lhs, string_view rhs) {
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  for (std::size_t i = 0; i < lhs.size(); i++) {
+    char l = lhs[i];
+    char r = rhs[i];
+    if (l != r) {
+      if (l >= 'A' && l <= 'Z') {
+        l = static_cast<char>(l + 0x20);
+      }
+      if (r >= 'A' && r <= 'Z') {
+        r = static_cast<char>(r + 0x20);
+      }
+      if (l != r) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace internal
+
+// A fast non-cryptographic 64-bit hash over the characters of s. It does
+// not allocate and gives the same result for a string and any view of the
+// same characters. Not stable across library versions; do not persist it.
+template <typename T>
+inline std::uint64_t hash(basic_string_view<T> s, std::uint64_t seed = 0) {
+  return internal::wyhash<internal::raw_reader>(s.data(), s.size() * sizeof(T),
+                                                seed);
+}
+
+inline std::uint64_t hash(const std::string &s, std::uint64_t seed = 0) {
+  return hash(string_view(s), seed);
+}
+
+inline std::uint64_t hash(const std::wstring &s, std::uint64_t seed = 0) {
+  return hash(wstring_view(s), seed);
+}
+
+inline std::uint64_t hash(const char *s, std::uint64_t seed = 0) {
+  return hash(string_view(s), seed);
+}
+
+inline std::uint64_t hash(const wchar_t *s, std::uint64_t seed = 0) {
+  return hash(wstring_view(s), seed);
+}
+
+// Same as hash(lowercase(s)) for ASCII letters, without making the copy
+inline std::uint64_t hashIgnoreCase(string_view s, std::uint64_t seed = 0) {
+  return internal::wyhash<internal::ascii_fold_reader>(s.data(), s.size(),
+                                                       seed);
+}
+
+// Hash and equality functors for unordered containers keyed by strings.
+// They accept std::string, views and literals alike and are marked
+// transparent, so containers that support heterogeneous lookup (C++20
+// std::unordered_map and most third-party hash maps) can be probed with a
+// view without building a std::string first.
+template <typename T>
+struct basic_string_hash {
+  typedef void is_transparent;
+
+  std::size_t operator()(basic_string_view<T> s) const {
+    return static_cast<std::size_t>(hash(s));
+  }
+};
+
+template <typename T>
+struct basic_string_equal {
+  typedef void is_transparent;
+
+  bool operator()(basic_string_view<T> lhs, basic_string_view<T> rhs) const {
+    return lhs == rhs;
+  }
+};
+
+typedef basic_string_hash<char> string_hash;
+typedef basic_string_hash<wchar_t> wstring_hash;
+typedef basic_string_equal<char> string_equal;
+typedef basic_string_equal<wchar_t> wstring_equal;
+
+// ASCII case-insensitive counterparts, to be used together
+struct istring_hash {
+  typedef void is_transparent;
+
+  std::size_t operator()(string_view s) const {
+    return static_cast<std::size_t>(hashIgnoreCase(s));
+  }
+};
+
+struct istring_equal {
+  typedef void is_transparent;
+
+  bool operator()(string_view lhs, string_view rhs) const {
+    return internal::equalsIgnoreCase(lhs, rhs);
+  }
+};
+
+}  // namespace string
+
+}  // namespace util
+
+namespace std {
+
+template <typename T>
+struct hash<util::string::basic_string_view<T>> {
+  std::size_t operator()(util::string::basic_string_view<T> s) const {
+    return static_cast<std::size_t>(util::string::hash(s));
+  }
+};
+
+}  // namespace std
+
+#endif  // INCLUDE_UTIL_STRING_HASH_HPP_
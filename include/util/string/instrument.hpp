@@ -0,0 +1,314 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_INSTRUMENT_HPP_
+#define INCLUDE_UTIL_STRING_INSTRUMENT_HPP_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace util {
+
+namespace string {
+
+// Per-API counters for the string functions. The functions of string.hpp
+// only report to them when compiled with UTIL_STRING_INSTRUMENTATION
+// defined (see probe.hpp); otherwise the hooks compile to nothing and the
+// counters below stay at zero.
+//
+// Every thread counts into its own slots, so recording never takes a lock.
+// collect() sums the slots of all live threads plus whatever threads that
+// have already exited left behind.
+namespace instrument {
+
+enum class Api : std::size_t {
+  Transform,
+  Trim,
+  Replace,
+  Reverse,
+  Translate,
+  Format,
+  Split,
+  Join,
+  Count
+};
+
+inline const char *name(Api api) {
+  static const char *const names[] = {
+    "transform", "trim", "replace", "reverse", "translate", "format",
+    "split", "join"
+  };
+  return names[static_cast<std::size_t>(api)];
+}
+
+// Latency bucket i counts the calls that took [2^i, 2^(i+1)) nanoseconds,
+// bucket 0 also counts calls under a nanosecond.
+static const std::size_t LATENCY_BUCKETS = 32;
+
+struct counters {
+  std::uint64_t calls = 0;
+  std::uint64_t bytes = 0;
+  // An estimate of the allocations per call, not a count: the heap blocks
+  // owned by the returned values, e.g. 1 for a string past the small string
+  // buffer. Temporaries, scratch buffers and reallocations while a result
+  // grows are not seen; AllocationCounter in test/ counts the real ones.
+  std::uint64_t result_blocks = 0;
+  std::array<std::uint64_t, LATENCY_BUCKETS> latency{};
+
+  counters &operator+=(const counters &other) {
+    calls += other.calls;
+    bytes += other.bytes;
+    result_blocks += other.result_blocks;
+    for (std::size_t i = 0; i < LATENCY_BUCKETS; i++) {
+      latency[i] += other.latency[i];
+    }
+    return *this;
+  }
+};
+
+struct snapshot {
+  std::array<counters, static_cast<std::size_t>(Api::Count)> apis;
+
+  const counters &operator[](Api api) const {
+    return apis[static_cast<std::size_t>(api)];
+  }
+};
+
+namespace internal {
+
+// Written by its own thread only; the atomics let collect() read them from
+// other threads without tearing.
+struct slot {
+  std::atomic<std::uint64_t> calls{0};
+  std::atomic<std::uint64_t> bytes{0};
+  std::atomic<std::uint64_t> result_blocks{0};
+  std::array<std::atomic<std::uint64_t>, LATENCY_BUCKETS> latency;
+
+  slot() {
+    for (auto &bucket : latency) {
+      bucket.store(0, std::memory_order_relaxed);
+    }
+  }
+};
+
+inline void bump(std::atomic<std::uint64_t> &value, std::uint64_t n) {
+  value.store(value.load(std::memory_order_relaxed) + n,
+              std::memory_order_relaxed);
+}
+
+class thread_slots;
+
+struct registry {
+  std::mutex mutex;
+  std::vector<thread_slots *> threads;
+  snapshot retired{};
+
+  static registry &instance() {
+    static registry *r = new registry();  // never destroyed, see ~thread_slots
+    return *r;
+  }
+};
+
+class thread_slots {
+ public:
+  thread_slots() {
+    registry &r = registry::instance();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.threads.push_back(this);
+  }
+
+  ~thread_slots() {
+    registry &r = registry::instance();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    addTo(r.retired);
+    for (auto it = r.threads.begin(); it != r.threads.end(); ++it) {
+      if (*it == this) {
+        r.threads.erase(it);
+        break;
+      }
+    }
+  }
+
+  slot &operator[](Api api) {
+    return slots_[static_cast<std::size_t>(api)];
+  }
+
+  void addTo(snapshot &out) const {
+    for (std::size_t i = 0; i < slots_.size(); i++) {
+      const slot &s = slots_[i];
+      counters c;
+      c.calls = s.calls.load(std::memory_order_relaxed);
+      c.bytes = s.bytes.load(std::memory_order_relaxed);
+      c.result_blocks = s.result_blocks.load(std::memory_order_relaxed);
+      for (std::size_t b = 0; b < LATENCY_BUCKETS; b++) {
+        c.latency[b] = s.latency[b].load(std::memory_order_relaxed);
+      }
+      out.apis[i] += c;
+    }
+  }
+
+  void reset() {
+    for (auto &s : slots_) {
+      s.calls.store(0, std::memory_order_relaxed);
+      s.bytes.store(0, std::memory_order_relaxed);
+      s.result_blocks.store(0, std::memory_order_relaxed);
+      for (auto &bucket : s.latency) {
+        bucket.store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+
+ private:
+  std::array<slot, static_cast<std::size_t>(Api::Count)> slots_;
+};
+
+inline thread_slots &local() {
+  static thread_local thread_slots slots;
+  return slots;
+}
+
+inline std::size_t bucket(std::uint64_t nanoseconds) {
+  std::size_t i = 0;
+  while (nanoseconds > 1 && i + 1 < LATENCY_BUCKETS) {
+    nanoseconds >>= 1;
+    i++;
+  }
+  return i;
+}
+
+// Heap blocks owned by a result: a string counts once its contents no
+// longer fit the small string buffer.
+template <typename T>
+inline std::uint64_t heapBlocks(const std::basic_string<T> &s) {
+  static const std::size_t inline_capacity = std::basic_string<T>().capacity();
+  return s.capacity() > inline_capacity ? 1 : 0;
+}
+
+template <typename T>
+inline std::uint64_t heapBlocks(const std::vector<T> &v) {
+  std::uint64_t blocks = v.capacity() > 0 ? 1 : 0;
+  for (const auto &item : v) {
+    blocks += heapBlocks(item);
+  }
+  return blocks;
+}
+
+template <typename T>
+inline std::uint64_t payload(const std::vector<std::basic_string<T>> &v) {
+  std::uint64_t bytes = 0;
+  for (const auto &item : v) {
+    bytes += item.size() * sizeof(T);
+  }
+  return bytes;
+}
+
+}  // namespace internal
+
+inline void record(Api api, std::uint64_t bytes,
+                   std::uint64_t result_blocks, std::uint64_t nanoseconds) {
+  internal::slot &s = internal::local()[api];
+  internal::bump(s.calls, 1);
+  internal::bump(s.bytes, bytes);
+  internal::bump(s.result_blocks, result_blocks);
+  internal::bump(s.latency[internal::bucket(nanoseconds)], 1);
+}
+
+inline snapshot collect() {
+  internal::registry &r = internal::registry::instance();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  snapshot out = r.retired;
+  for (const auto *slots : r.threads) {
+    slots->addTo(out);
+  }
+  return out;
+}
+
+// Clears the counters of the calling thread and of exited threads. Other
+// live threads keep theirs, since only their owner writes to them.
+inline void reset() {
+  internal::local().reset();
+  internal::registry &r = internal::registry::instance();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  r.retired = snapshot();
+}
+
+// Calls f(name, counters) for every API, e.g. to feed a metrics exporter
+template <typename Function>
+inline void forEach(const snapshot &s, Function f) {
+  for (std::size_t i = 0; i < static_cast<std::size_t>(Api::Count); i++) {
+    f(name(static_cast<Api>(i)), s.apis[i]);
+  }
+}
+
+// Times one call of an API and records it when it goes out of scope
+class probe {
+ public:
+  probe(Api api, std::uint64_t bytes)
+      : api_(api), bytes_(bytes), result_blocks_(0),
+        start_(std::chrono::steady_clock::now()) {
+  }
+
+  ~probe() {
+    auto elapsed = std::chrono::steady_clock::now() - start_;
+    record(api_, bytes_, result_blocks_,
+           std::chrono::duration_cast<std::chrono::nanoseconds>(
+               elapsed).count());
+  }
+
+  probe(const probe &) = delete;
+  probe &operator=(const probe &) = delete;
+
+  // For calls that only learn their size while they run
+  void setBytes(std::uint64_t bytes) {
+    bytes_ = bytes;
+  }
+
+  template <typename R>
+  typename std::remove_reference<R>::type &&result(R &&r) {
+    result_blocks_ += internal::heapBlocks(r);
+    return std::move(r);
+  }
+
+ private:
+  Api api_;
+  std::uint64_t bytes_;
+  std::uint64_t result_blocks_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace instrument
+
+}  // namespace string
+
+}  // namespace util
+
+#endif  // INCLUDE_UTIL_STRING_INSTRUMENT_HPP_
@@ -0,0 +1,203 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_LINES_HPP_
+#define INCLUDE_UTIL_STRING_LINES_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+#include "util/string/string_view.hpp"
+
+namespace util {
+
+namespace string {
+
+enum class LineEnding { Keep, StripCR };
+
+// Iterates over the lines of a buffer as views, without copying them.
+// Lines end at '\n', which is not part of the view; with
+// LineEnding::StripCR a '\r' right before it is dropped as well, so CRLF
+// files read like LF ones. A final line without '\n' is still a line, but
+// a trailing '\n' does not start an empty one, as with std::getline.
+// Newlines are found with std::char_traits<T>::find, i.e. memchr/wmemchr.
+template <typename T>
+class basic_line_range {
+ public:
+  class iterator {
+   public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef basic_string_view<T> value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const basic_string_view<T> *pointer;
+    typedef const basic_string_view<T> &reference;
+
+    iterator() : rest_(), ending_(LineEnding::Keep), done_(true) {
+    }
+
+    iterator(basic_string_view<T> s, LineEnding ending)
+        : rest_(s), ending_(ending), done_(s.empty()) {
+      if (!done_) {
+        advance();
+      }
+    }
+
+    reference operator*() const {
+      return line_;
+    }
+
+    pointer operator->() const {
+      return &line_;
+    }
+
+    iterator &operator++() {
+      done_ = rest_.empty();
+      if (!done_) {
+        advance();
+      }
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    bool operator==(const iterator &other) const {
+      return done_ == other.done_ &&
+          (done_ || line_.data() == other.line_.data());
+    }
+
+    bool operator!=(const iterator &other) const {
+      return !(*this == other);
+    }
+
+   private:
+    void advance() {
+      const T *newline = std::char_traits<T>::find(rest_.data(),
+                                                   rest_.size(), T('\n'));
+      std::size_t length = newline ? newline - rest_.data() : rest_.size();
+      line_ = basic_string_view<T>(rest_.data(), length);
+      rest_.remove_prefix(newline ? length + 1 : length);
+      if (ending_ == LineEnding::StripCR && !line_.empty() &&
+          line_.back() == T('\r')) {
+        line_.remove_suffix(1);
+      }
+    }
+
+    basic_string_view<T> rest_;
+    basic_string_view<T> line_;
+    LineEnding ending_;
+    bool done_;
+  };
+
+  typedef iterator const_iterator;
+
+  explicit basic_line_range(basic_string_view<T> s,
+                            LineEnding ending = LineEnding::Keep)
+      : s_(s), ending_(ending) {
+  }
+
+  iterator begin() const {
+    return iterator(s_, ending_);
+  }
+
+  iterator end() const {
+    return iterator();
+  }
+
+ private:
+  basic_string_view<T> s_;
+  LineEnding ending_;
+};
+
+typedef basic_line_range<char> line_range;
+typedef basic_line_range<wchar_t> wline_range;
+
+inline line_range lines(string_view s, LineEnding ending = LineEnding::Keep) {
+  return line_range(s, ending);
+}
+
+inline wline_range lines(wstring_view s,
+                         LineEnding ending = LineEnding::Keep) {
+  return wline_range(s, ending);
+}
+
+// Cuts s into at most count consecutive blocks of about equal size, each
+// ending right after a '\n' (or at the end of s), so that no line is split
+// between two blocks.
+template <typename T>
+inline std::vector<basic_string_view<T>> blocks(basic_string_view<T> s,
+                                                std::size_t count) {
+  std::vector<basic_string_view<T>> out;
+  count = std::max<std::size_t>(count, 1);
+  const std::size_t target = s.size() / count + 1;
+  while (!s.empty()) {
+    std::size_t cut = std::min(target, s.size());
+    const T *newline = std::char_traits<T>::find(s.data() + cut - 1,
+                                                 s.size() - cut + 1, T('\n'));
+    cut = newline ? newline - s.data() + 1 : s.size();
+    out.push_back(s.substr(0, cut));
+    s.remove_prefix(cut);
+  }
+  return out;
+}
+
+// Splits s into blocks of whole lines and calls f(index, lines) for every
+// block, where lines is a basic_line_range over it. Blocks are handed to
+// up to `threads` threads, so f must be safe to call concurrently and must
+// not throw; the block index lets it write to per-block state instead of
+// sharing any.
+template <typename T, typename Function>
+inline void forEachBlock(basic_string_view<T> s, std::size_t threads,
+                         Function f, LineEnding ending = LineEnding::Keep) {
+  std::vector<basic_string_view<T>> parts = blocks(s, threads);
+  if (parts.size() <= 1) {
+    for (std::size_t i = 0; i < parts.size(); i++) {
+      f(i, basic_line_range<T>(parts[i], ending));
+    }
+    return;
+  }
+  std::vector<std::thread> workers;
+  workers.reserve(parts.size() - 1);
+  for (std::size_t i = 1; i < parts.size(); i++) {
+    workers.emplace_back([&, i] {
+      f(i, basic_line_range<T>(parts[i], ending));
+    });
+  }
+  f(0, basic_line_range<T>(parts[0], ending));
+  for (auto &worker : workers) {
+    worker.join();
+  }
+}
+
+}  // namespace string
+
+}  // namespace util
+
+#endif  // INCLUDE_UTIL_STRING_LINES_HPP_
@@ -0,0 +1,296 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_MATCHER_HPP_
+#define INCLUDE_UTIL_STRING_MATCHER_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace util {
+
+namespace string {
+
+enum class MatchKind { Prefix, Suffix, Contains };
+
+namespace internal {
+
+// Maps each character that occurs in the needles to a dense class id, so
+// that the transition table only has a column per distinct character.
+// Class 0 stands for every character that does not occur in any needle.
+template <typename T, bool Narrow = (sizeof(T) == 1)>
+class char_classes;
+
+template <typename T>
+class char_classes<T, true> {
+ public:
+  void build(const std::vector<T> &alphabet) {
+    table_.fill(0);
+    for (std::size_t i = 0; i < alphabet.size(); i++) {
+      table_[index(alphabet[i])] = static_cast<std::uint16_t>(i + 1);
+    }
+  }
+
+  std::size_t operator()(const T ch) const {
+    return table_[index(ch)];
+  }
+
+ private:
+  static std::size_t index(const T ch) {
+    return static_cast<typename std::make_unsigned<T>::type>(ch);
+  }
+
+  std::array<std::uint16_t, 256> table_;
+};
+
+template <typename T>
+class char_classes<T, false> {
+ public:
+  void build(const std::vector<T> &alphabet) {
+    alphabet_ = alphabet;
+  }
+
+  std::size_t operator()(const T ch) const {
+    auto it = std::lower_bound(alphabet_.begin(), alphabet_.end(), ch);
+    if (it == alphabet_.end() || *it != ch) {
+      return 0;
+    }
+    return static_cast<std::size_t>(it - alphabet_.begin()) + 1;
+  }
+
+ private:
+  std::vector<T> alphabet_;
+};
+
+}  // namespace internal
+
+// Matches a fixed set of N needles against an input in a single pass and
+// returns the index of the first needle (in declaration order) for which
+// startsWith, endsWith or contains would return true, or npos if none does.
+//
+// Prefix and suffix matchers walk a trie of the needles; the contains
+// matcher is an Aho-Corasick automaton flattened into a DFA. The tables are
+// built once by the constructor, so matchers are meant to be kept in static
+// storage and reused.
+template <typename T, std::size_t N>
+class basic_matcher {
+ public:
+  static const std::size_t npos = static_cast<std::size_t>(-1);
+
+  basic_matcher(MatchKind kind,
+                const std::array<std::basic_string<T>, N> &needles)
+      : kind_(kind) {
+    build(needles);
+  }
+
+  MatchKind kind() const {
+    return kind_;
+  }
+
+  std::size_t size() const {
+    return N;
+  }
+
+  std::size_t find(const T *s, std::size_t length) const {
+    switch (kind_) {
+      case MatchKind::Prefix:
+        return walk(s, s + length);
+      case MatchKind::Suffix:
+        return walk(std::reverse_iterator<const T *>(s + length),
+                    std::reverse_iterator<const T *>(s));
+      default:
+        return scan(s, s + length);
+    }
+  }
+
+  std::size_t find(const std::basic_string<T> &s) const {
+    return find(s.data(), s.size());
+  }
+
+  std::size_t find(const T *s) const {
+    return find(s, std::char_traits<T>::length(s));
+  }
+
+  template <typename S>
+  std::size_t operator()(const S &s) const {
+    return find(s);
+  }
+
+ private:
+  typedef std::int32_t state_type;
+
+  static std::uint32_t npos32() {
+    return static_cast<std::uint32_t>(-1);
+  }
+
+  void build(const std::array<std::basic_string<T>, N> &needles) {
+    std::vector<T> alphabet;
+    for (const auto &needle : needles) {
+      alphabet.insert(alphabet.end(), needle.begin(), needle.end());
+    }
+    std::sort(alphabet.begin(), alphabet.end());
+    alphabet.erase(std::unique(alphabet.begin(), alphabet.end()),
+                   alphabet.end());
+    classes_.build(alphabet);
+    width_ = alphabet.size() + 1;
+
+    addState();
+    for (std::size_t i = 0; i < N; i++) {
+      if (kind_ == MatchKind::Suffix) {
+        insert(needles[i].rbegin(), needles[i].rend(), i);
+      } else {
+        insert(needles[i].begin(), needles[i].end(), i);
+      }
+    }
+    if (kind_ == MatchKind::Contains) {
+      link();
+    }
+  }
+
+  state_type addState() {
+    next_.insert(next_.end(), width_, -1);
+    output_.push_back(npos32());
+    return static_cast<state_type>(output_.size() - 1);
+  }
+
+  template <typename Iterator>
+  void insert(Iterator first, Iterator last, std::size_t index) {
+    state_type state = 0;
+    for (; first != last; ++first) {
+      auto &slot = next_[state * width_ + classes_(*first)];
+      if (slot < 0) {
+        // addState() may reallocate next_, so never hold the reference
+        auto created = addState();
+        next_[state * width_ + classes_(*first)] = created;
+        state = created;
+      } else {
+        state = slot;
+      }
+    }
+    output_[state] = std::min(output_[state],
+                              static_cast<std::uint32_t>(index));
+  }
+
+  // Turns the trie into a DFA: missing transitions follow the failure link
+  // and every state inherits the best output of its failure state.
+  void link() {
+    std::vector<state_type> fail(output_.size(), 0);
+    std::deque<state_type> queue;
+    for (std::size_t c = 0; c < width_; c++) {
+      auto &slot = next_[c];
+      if (slot < 0) {
+        slot = 0;
+      } else {
+        queue.push_back(slot);
+      }
+    }
+    while (!queue.empty()) {
+      auto state = queue.front();
+      queue.pop_front();
+      output_[state] = std::min(output_[state], output_[fail[state]]);
+      for (std::size_t c = 0; c < width_; c++) {
+        auto &slot = next_[state * width_ + c];
+        auto fallback = next_[fail[state] * width_ + c];
+        if (slot < 0) {
+          slot = fallback;
+        } else {
+          fail[slot] = fallback;
+          queue.push_back(slot);
+        }
+      }
+    }
+  }
+
+  template <typename Iterator>
+  std::size_t walk(Iterator first, Iterator last) const {
+    std::uint32_t best = output_[0];
+    state_type state = 0;
+    for (; first != last && best != 0; ++first) {
+      state = next_[state * width_ + classes_(*first)];
+      if (state < 0) {
+        break;
+      }
+      best = std::min(best, output_[state]);
+    }
+    return best == npos32() ? npos : best;
+  }
+
+  std::size_t scan(const T *first, const T *last) const {
+    std::uint32_t best = output_[0];
+    state_type state = 0;
+    for (; first != last && best != 0; ++first) {
+      state = next_[state * width_ + classes_(*first)];
+      best = std::min(best, output_[state]);
+    }
+    return best == npos32() ? npos : best;
+  }
+
+  MatchKind kind_;
+  std::size_t width_ = 0;
+  internal::char_classes<T> classes_;
+  std::vector<state_type> next_;
+  std::vector<std::uint32_t> output_;
+};
+
+template <typename T, std::size_t N>
+const std::size_t basic_matcher<T, N>::npos;
+
+template <typename T, typename ... Needles>
+inline basic_matcher<T, sizeof...(Needles) + 1>
+makeMatcher(MatchKind kind, const T *first, const Needles& ... rest) {
+  std::array<std::basic_string<T>, sizeof...(Needles) + 1> needles = {{
+      std::basic_string<T>(first), std::basic_string<T>(rest) ...}};
+  return basic_matcher<T, sizeof...(Needles) + 1>(kind, needles);
+}
+
+template <typename T, typename ... Needles>
+inline basic_matcher<T, sizeof...(Needles) + 1>
+prefixMatcher(const T *first, const Needles& ... rest) {
+  return makeMatcher(MatchKind::Prefix, first, rest ...);
+}
+
+template <typename T, typename ... Needles>
+inline basic_matcher<T, sizeof...(Needles) + 1>
+suffixMatcher(const T *first, const Needles& ... rest) {
+  return makeMatcher(MatchKind::Suffix, first, rest ...);
+}
+
+template <typename T, typename ... Needles>
+inline basic_matcher<T, sizeof...(Needles) + 1>
+containsMatcher(const T *first, const Needles& ... rest) {
+  return makeMatcher(MatchKind::Contains, first, rest ...);
+}
+
+}  // namespace string
+
+}  // namespace util
+
+#endif  // INCLUDE_UTIL_STRING_MATCHER_HPP_
@@ -0,0 +1,529 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_PIPELINE_HPP_
+#define INCLUDE_UTIL_STRING_PIPELINE_HPP_
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "util/string/char_set.hpp"
+#include "util/string/string_view.hpp"
+
+namespace util {
+
+namespace string {
+
+// Stages of a pipeline, composed left to right with operator|:
+//
+//   auto clean = stage::replace("a", "b") | stage::lowercase() |
+//                stage::trim();
+//   std::string s = clean(input);  // trim(lowercase(replace(input, ...)))
+//
+// A pipeline is evaluated in one pass over its input. Every stage is a sink
+// that passes characters on to the next one, and only the last one writes,
+// straight into the result. Stages that have to look ahead keep a small
+// buffer: replace holds a partial match, trim holds a run of trailing
+// characters and reverse holds its whole input.
+namespace stage {
+
+namespace internal {
+
+struct stage_tag {
+};
+
+template <typename T>
+struct is_stage : std::is_base_of<stage_tag, T> {
+};
+
+// Passes characters to the next sink in chunks, so that sinks further down
+// can work on runs instead of single characters.
+template <typename T, typename Next, typename Function>
+inline void writeMapped(Next &next, const T *s, std::size_t length,
+                        const Function &f) {
+  T chunk[256];
+  while (length > 0) {
+    std::size_t count = std::min(length, sizeof(chunk) / sizeof(T));
+    std::transform(s, s + count, chunk, f);
+    next.write(chunk, count);
+    s += count;
+    length -= count;
+  }
+}
+
+}  // namespace internal
+
+template <typename UnaryFunction>
+struct transform_stage : internal::stage_tag {
+  UnaryFunction func;
+
+  explicit transform_stage(UnaryFunction func) : func(func) {
+  }
+
+  template <typename T, typename Next>
+  class sink {
+   public:
+    sink(const transform_stage &stage, Next next)
+        : stage_(stage), next_(next) {
+    }
+
+    void put(const T ch) {
+      next_.put(static_cast<T>(stage_.func(ch)));
+    }
+
+    void write(const T *s, std::size_t length) {
+      const UnaryFunction &f = stage_.func;
+      internal::writeMapped(next_, s, length,
+                            [&](const T ch) { return static_cast<T>(f(ch)); });
+    }
+
+    void finish() {
+      next_.finish();
+    }
+
+   private:
+    const transform_stage &stage_;
+    Next next_;
+  };
+};
+
+template <typename CharT>
+struct translate_stage : internal::stage_tag {
+  std::basic_string<CharT> from;
+  std::basic_string<CharT> to;
+
+  translate_stage(const std::basic_string<CharT> &from,
+                  const std::basic_string<CharT> &to)
+      : from(from), to(to) {
+  }
+
+  CharT operator()(const CharT ch) const {
+    auto length = std::min(from.size(), to.size());
+    for (std::size_t i = 0; i < length; i++) {
+      if (ch == from[i]) {
+        return to[i];
+      }
+    }
+    return ch;
+  }
+
+  template <typename T, typename Next>
+  class sink {
+   public:
+    sink(const translate_stage &stage, Next next)
+        : stage_(stage), next_(next) {
+    }
+
+    void put(const T ch) {
+      next_.put(stage_(ch));
+    }
+
+    void write(const T *s, std::size_t length) {
+      internal::writeMapped(next_, s, length, stage_);
+    }
+
+    void finish() {
+      next_.finish();
+    }
+
+   private:
+    const translate_stage &stage_;
+    Next next_;
+  };
+};
+
+template <typename CharT>
+struct trim_stage : internal::stage_tag {
+  basic_char_set<CharT> set;
+
+  explicit trim_stage(const basic_char_set<CharT> &set) : set(set) {
+  }
+
+  template <typename T, typename Next>
+  class sink {
+   public:
+    sink(const trim_stage &stage, Next next)
+        : stage_(stage), next_(next), started_(false) {
+    }
+
+    void put(const T ch) {
+      write(&ch, 1);
+    }
+
+    void write(const T *s, std::size_t length) {
+      if (!started_) {
+        std::size_t skipped = stage_.set.span(s, length);
+        s += skipped;
+        length -= skipped;
+        if (length == 0) {
+          return;
+        }
+        started_ = true;
+      }
+      std::size_t tail = stage_.set.rspan(s, length);
+      if (tail == length) {
+        pending_.append(s, length);
+        return;
+      }
+      if (!pending_.empty()) {
+        next_.write(pending_.data(), pending_.size());
+        pending_.clear();
+      }
+      next_.write(s, length - tail);
+      pending_.assign(s + length - tail, tail);
+    }
+
+    void finish() {
+      next_.finish();
+    }
+
+   private:
+    const trim_stage &stage_;
+    Next next_;
+    bool started_;
+    std::basic_string<T> pending_;
+  };
+};
+
+template <typename CharT>
+struct replace_stage : internal::stage_tag {
+  std::basic_string<CharT> from;
+  std::basic_string<CharT> to;
+  // fail[i] is the length of the longest proper prefix of from[0..i] that
+  // is also its suffix, as in Knuth-Morris-Pratt.
+  std::vector<std::size_t> fail;
+
+  replace_stage(const std::basic_string<CharT> &from,
+                const std::basic_string<CharT> &to)
+      : from(from), to(to), fail(from.size(), 0) {
+    for (std::size_t i = 1, k = 0; i < from.size(); i++) {
+      while (k > 0 && from[i] != from[k]) {
+        k = fail[k - 1];
+      }
+      if (from[i] == from[k]) {
+        k++;
+      }
+      fail[i] = k;
+    }
+  }
+
+  template <typename T, typename Next>
+  class sink {
+   public:
+    sink(const replace_stage &stage, Next next)
+        : stage_(stage), next_(next), matched_(0) {
+    }
+
+    void put(const T ch) {
+      const std::basic_string<T> &from = stage_.from;
+      if (from.empty()) {
+        next_.put(ch);
+        return;
+      }
+      while (matched_ > 0 && from[matched_] != ch) {
+        std::size_t kept = stage_.fail[matched_ - 1];
+        next_.write(from.data(), matched_ - kept);
+        matched_ = kept;
+      }
+      if (from[matched_] != ch) {
+        next_.put(ch);
+      } else if (++matched_ == from.size()) {
+        next_.write(stage_.to.data(), stage_.to.size());
+        matched_ = 0;
+      }
+    }
+
+    void write(const T *s, std::size_t length) {
+      if (stage_.from.empty()) {
+        next_.write(s, length);
+        return;
+      }
+      const T *end = s + length;
+      while (s != end) {
+        if (matched_ == 0) {
+          const T *found = std::char_traits<T>::find(s, end - s,
+                                                     stage_.from[0]);
+          const T *run = found ? found : end;
+          if (run != s) {
+            next_.write(s, run - s);
+            s = run;
+          }
+          if (s == end) {
+            break;
+          }
+        }
+        put(*s++);
+      }
+    }
+
+    void finish() {
+      next_.write(stage_.from.data(), matched_);
+      matched_ = 0;
+      next_.finish();
+    }
+
+   private:
+    const replace_stage &stage_;
+    Next next_;
+    std::size_t matched_;
+  };
+};
+
+struct reverse_stage : internal::stage_tag {
+  template <typename T, typename Next>
+  class sink {
+   public:
+    sink(const reverse_stage &, Next next) : next_(next) {
+    }
+
+    void put(const T ch) {
+      buffer_.push_back(ch);
+    }
+
+    void write(const T *s, std::size_t length) {
+      buffer_.append(s, length);
+    }
+
+    void finish() {
+      std::reverse(buffer_.begin(), buffer_.end());
+      next_.write(buffer_.data(), buffer_.size());
+      next_.finish();
+    }
+
+   private:
+    Next next_;
+    std::basic_string<T> buffer_;
+  };
+};
+
+template <typename UnaryFunction>
+inline transform_stage<UnaryFunction> transform(UnaryFunction func) {
+  return transform_stage<UnaryFunction>(func);
+}
+
+inline transform_stage<int (*)(int)> uppercase() {
+  return transform(static_cast<int (*)(int)>(::toupper));
+}
+
+inline transform_stage<int (*)(int)> lowercase() {
+  return transform(static_cast<int (*)(int)>(::tolower));
+}
+
+template <typename T>
+inline translate_stage<T> translate(const T *from, const T *to) {
+  return translate_stage<T>(from, to);
+}
+
+inline trim_stage<char> trim() {
+  return trim_stage<char>(whitespace());
+}
+
+template <typename T>
+inline trim_stage<T> trim(const T *chars) {
+  return trim_stage<T>(basic_char_set<T>(chars));
+}
+
+template <typename T>
+inline replace_stage<T> replace(const T *from, const T *to) {
+  return replace_stage<T>(from, to);
+}
+
+inline reverse_stage reverse() {
+  return reverse_stage();
+}
+
+}  // namespace stage
+
+namespace internal {
+
+template <typename T>
+class append_sink {
+ public:
+  explicit append_sink(std::basic_string<T> &out) : out_(out) {
+  }
+
+  void put(const T ch) {
+    out_.push_back(ch);
+  }
+
+  void write(const T *s, std::size_t length) {
+    out_.append(s, length);
+  }
+
+  void finish() {
+  }
+
+ private:
+  std::basic_string<T> &out_;
+};
+
+struct pipeline_end {
+  template <typename T, typename Final>
+  struct sink_type {
+    typedef Final type;
+  };
+
+  template <typename T, typename Final>
+  Final bind(Final final) const {
+    return final;
+  }
+};
+
+}  // namespace internal
+
+// A chain of stages stored as a cons list: Head runs first, then the stages
+// of Tail, which is another basic_pipeline or internal::pipeline_end.
+template <typename Head, typename Tail = internal::pipeline_end>
+class basic_pipeline {
+ public:
+  template <typename T, typename Final>
+  struct sink_type {
+    typedef typename Head::template sink<
+      T, typename Tail::template sink_type<T, Final>::type> type;
+  };
+
+  basic_pipeline(const Head &head, const Tail &tail)
+      : head_(head), tail_(tail) {
+  }
+
+  const Head &head() const {
+    return head_;
+  }
+
+  const Tail &tail() const {
+    return tail_;
+  }
+
+  template <typename T, typename Final>
+  typename sink_type<T, Final>::type bind(Final final) const {
+    return typename sink_type<T, Final>::type(
+        head_, tail_.template bind<T>(final));
+  }
+
+  // Runs the pipeline over s and appends the result to out
+  template <typename T>
+  void appendTo(basic_string_view<T> s, std::basic_string<T> &out) const {
+    out.reserve(out.size() + s.size());
+    auto sink = bind<T>(internal::append_sink<T>(out));
+    sink.write(s.data(), s.size());
+    sink.finish();
+  }
+
+  template <typename T>
+  void appendTo(const std::basic_string<T> &s,
+                std::basic_string<T> &out) const {
+    appendTo(basic_string_view<T>(s), out);
+  }
+
+  template <typename T>
+  void appendTo(const T *s, std::basic_string<T> &out) const {
+    appendTo(basic_string_view<T>(s), out);
+  }
+
+  template <typename T>
+  std::basic_string<T> operator()(basic_string_view<T> s) const {
+    std::basic_string<T> out;
+    appendTo(s, out);
+    return out;
+  }
+
+  template <typename T>
+  std::basic_string<T> operator()(const std::basic_string<T> &s) const {
+    return (*this)(basic_string_view<T>(s));
+  }
+
+  template <typename T>
+  std::basic_string<T> operator()(const T *s) const {
+    return (*this)(basic_string_view<T>(s));
+  }
+
+ private:
+  Head head_;
+  Tail tail_;
+};
+
+namespace internal {
+
+template <typename Pipeline, typename Stage>
+struct append_stage;
+
+template <typename Stage>
+struct append_stage<pipeline_end, Stage> {
+  typedef basic_pipeline<Stage> type;
+
+  static type apply(const pipeline_end &end, const Stage &stage) {
+    return type(stage, end);
+  }
+};
+
+template <typename Head, typename Tail, typename Stage>
+struct append_stage<basic_pipeline<Head, Tail>, Stage> {
+  typedef basic_pipeline<Head, typename append_stage<Tail, Stage>::type> type;
+
+  static type apply(const basic_pipeline<Head, Tail> &pipeline,
+                    const Stage &stage) {
+    return type(pipeline.head(),
+                append_stage<Tail, Stage>::apply(pipeline.tail(), stage));
+  }
+};
+
+}  // namespace internal
+
+namespace stage {
+
+template <typename Lhs, typename Rhs>
+inline typename std::enable_if<
+  internal::is_stage<Lhs>::value && internal::is_stage<Rhs>::value,
+  basic_pipeline<Lhs, basic_pipeline<Rhs>>>::type
+operator|(const Lhs &lhs, const Rhs &rhs) {
+  return basic_pipeline<Lhs, basic_pipeline<Rhs>>(
+      lhs, basic_pipeline<Rhs>(rhs, util::string::internal::pipeline_end()));
+}
+
+}  // namespace stage
+
+template <typename Head, typename Tail, typename Stage>
+inline typename std::enable_if<
+  stage::internal::is_stage<Stage>::value,
+  typename internal::append_stage<basic_pipeline<Head, Tail>,
+                                  Stage>::type>::type
+operator|(const basic_pipeline<Head, Tail> &pipeline, const Stage &stage) {
+  return internal::append_stage<basic_pipeline<Head, Tail>, Stage>::apply(
+      pipeline, stage);
+}
+
+// Wraps a single stage into a pipeline
+template <typename Stage>
+inline basic_pipeline<Stage> pipe(const Stage &stage) {
+  return basic_pipeline<Stage>(stage, internal::pipeline_end());
+}
+
+}  // namespace string
+
+}  // namespace util
+
+#endif  // INCLUDE_UTIL_STRING_PIPELINE_HPP_
@@ -0,0 +1,60 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_PROBE_HPP_
+#define INCLUDE_UTIL_STRING_PROBE_HPP_
+
+// Hooks placed in the string functions. They expand to nothing unless
+// UTIL_STRING_INSTRUMENTATION is defined, so uninstrumented builds do not
+// even pay for the includes of instrument.hpp.
+//
+//   UTIL_STRING_PROBE(Split, s.size() * sizeof(T));  // time this call
+//   UTIL_STRING_PROBE_BYTES(n);  // the size, once a call has worked it out
+//   return UTIL_STRING_PROBE_RETURN(tokens);  // count what tokens owns
+
+#ifdef UTIL_STRING_INSTRUMENTATION
+
+#include "util/string/instrument.hpp"
+
+#define UTIL_STRING_PROBE(api, bytes)                                   \
+  ::util::string::instrument::probe util_string_probe_(                 \
+      ::util::string::instrument::Api::api, (bytes))
+
+#define UTIL_STRING_PROBE_BYTES(bytes)                                  \
+  util_string_probe_.setBytes(bytes)
+
+#define UTIL_STRING_PROBE_RETURN(value)                                 \
+  util_string_probe_.result(std::move(value))
+
+#else
+
+#define UTIL_STRING_PROBE(api, bytes) do {} while (0)
+
+#define UTIL_STRING_PROBE_BYTES(bytes) do {} while (0)
+
+#define UTIL_STRING_PROBE_RETURN(value) value
+
+#endif
+
+#endif  // INCLUDE_UTIL_STRING_PROBE_HPP_
@@ -0,0 +1,133 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_REPLACE_HPP_
+#define INCLUDE_UTIL_STRING_REPLACE_HPP_
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include "util/string/probe.hpp"
+
+namespace util {
+
+namespace string {
+
+template <typename T>
+std::basic_string<T> replace(std::basic_string<T> s,
+                             const T from, const T to) {
+  UTIL_STRING_PROBE(Replace, s.size() * sizeof(T));
+  std::replace(s.begin(), s.end(), from, to);
+  return UTIL_STRING_PROBE_RETURN(s);
+}
+
+template <typename T>
+inline std::basic_string<T> replace(const T *s, const T from, const T to) {
+  return replace(std::basic_string<T>(s), from, to);
+}
+
+template <typename T>
+std::basic_string<T> replace(std::basic_string<T> s,
+                             const std::basic_string<T> &from,
+                             const std::basic_string<T> &to) {
+  UTIL_STRING_PROBE(Replace, s.size() * sizeof(T));
+  if (from.empty()) {
+    return UTIL_STRING_PROBE_RETURN(s);
+  }
+  std::size_t position = 0;
+  while ((position = s.find(from, position)) != std::string::npos) {
+    s.replace(position, from.length(), to);
+    position += to.length();
+  }
+  return UTIL_STRING_PROBE_RETURN(s);
+}
+
+template <typename T>
+inline std::basic_string<T> replace(const T *s,
+                                    const std::basic_string<T> &from,
+                                    const std::basic_string<T> &to) {
+  return replace(std::basic_string<T>(s), from, to);
+}
+
+template <typename T>
+inline std::basic_string<T> replace(std::basic_string<T> s,
+                                    const T *from,
+                                    const std::basic_string<T> &to) {
+  return replace(std::move(s), std::basic_string<T>(from), to);
+}
+
+template <typename T>
+inline std::basic_string<T> replace(std::basic_string<T> s,
+                                    const std::basic_string<T> &from,
+                                    const T *to) {
+  return replace(std::move(s), from, std::basic_string<T>(to));
+}
+
+template <typename T>
+inline std::basic_string<T> replace(const T *s,
+                                    const T *from,
+                                    const std::basic_string<T> &to) {
+  return replace(std::basic_string<T>(s), std::basic_string<T>(from), to);
+}
+
+template <typename T>
+inline std::basic_string<T> replace(const T *s,
+                                    const std::basic_string<T> &from,
+                                    const T *to) {
+  return replace(std::basic_string<T>(s), from, std::basic_string<T>(to));
+}
+
+template <typename T>
+inline std::basic_string<T> replace(std::basic_string<T> s,
+                                    const T *from,
+                                    const T *to) {
+  return replace(std::move(s),
+                 std::basic_string<T>(from), std::basic_string<T>(to));
+}
+
+template <typename T>
+inline std::basic_string<T> replace(const T *s,
+                                    const T *from,
+                                    const T *to) {
+  return replace(std::basic_string<T>(s),
+                 std::basic_string<T>(from),
+                 std::basic_string<T>(to));
+}
+
+#define UTIL_STRING_INSTANTIATE_REPLACE(EXTERN, T)                            \
+  EXTERN template std::basic_string<T> replace(std::basic_string<T>,          \
+      const T, const T);                                                      \
+  EXTERN template std::basic_string<T> replace(std::basic_string<T>,          \
+      const std::basic_string<T> &, const std::basic_string<T> &);
+
+#ifdef UTIL_STRING_EXTERN_TEMPLATES
+UTIL_STRING_INSTANTIATE_REPLACE(extern, char)
+UTIL_STRING_INSTANTIATE_REPLACE(extern, wchar_t)
+#endif
+
+}  // namespace string
+
+}  // namespace util
+
+#endif  // INCLUDE_UTIL_STRING_REPLACE_HPP_
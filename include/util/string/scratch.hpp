@@ -0,0 +1,204 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_SCRATCH_HPP_
+#define INCLUDE_UTIL_STRING_SCRATCH_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace util {
+
+namespace string {
+
+// Reusable scratch buffers for the temporaries of the string functions,
+// such as the output buffer of format(). Pooling is off until enable() is
+// called; until then every buffer is a plain allocation, as before.
+//
+// Each thread keeps its own pool, so acquiring and releasing never takes a
+// lock. A released buffer is kept only while the pool holds fewer than
+// limits::buffers of them and only if it is at most limits::capacity
+// characters long, so one huge input does not pin its memory for the rest
+// of the thread's life.
+namespace scratch {
+
+struct limits {
+  std::size_t buffers = 4;
+  std::size_t capacity = 64 * 1024;
+};
+
+// Counts for the calling thread
+struct statistics {
+  std::uint64_t hits = 0;      // served by a pooled buffer
+  std::uint64_t misses = 0;    // had to allocate
+  std::uint64_t discards = 0;  // freed on release to stay within limits
+};
+
+namespace internal {
+
+struct settings {
+  std::atomic<bool> enabled{false};
+  std::atomic<std::size_t> buffers{limits().buffers};
+  std::atomic<std::size_t> capacity{limits().capacity};
+
+  static settings &instance() {
+    static settings s;
+    return s;
+  }
+};
+
+inline bool enabled() {
+  return settings::instance().enabled.load(std::memory_order_relaxed);
+}
+
+template <typename T>
+struct block {
+  std::unique_ptr<T[]> data;
+  std::size_t capacity = 0;
+};
+
+inline statistics &localStatistics() {
+  static thread_local statistics stats;
+  return stats;
+}
+
+template <typename T>
+inline std::vector<block<T>> &localPool() {
+  static thread_local std::vector<block<T>> pool;
+  return pool;
+}
+
+}  // namespace internal
+
+// Turns pooling on for all threads
+inline void enable(const limits &l = limits()) {
+  internal::settings &s = internal::settings::instance();
+  s.buffers.store(l.buffers, std::memory_order_relaxed);
+  s.capacity.store(l.capacity, std::memory_order_relaxed);
+  s.enabled.store(true, std::memory_order_relaxed);
+}
+
+// Turns pooling off. Buffers already retained are freed as their threads
+// release() them or exit.
+inline void disable() {
+  internal::settings::instance().enabled.store(false,
+                                               std::memory_order_relaxed);
+}
+
+inline bool enabled() {
+  return internal::enabled();
+}
+
+inline statistics stats() {
+  return internal::localStatistics();
+}
+
+inline void resetStats() {
+  internal::localStatistics() = statistics();
+}
+
+// Frees the buffers the calling thread retains
+inline void release() {
+  std::vector<internal::block<char>>().swap(internal::localPool<char>());
+  std::vector<internal::block<wchar_t>>().swap(
+      internal::localPool<wchar_t>());
+}
+
+// A buffer of at least size characters, taken from the calling thread's
+// pool when pooling is on and given back when it goes out of scope. The
+// contents are uninitialised.
+template <typename T>
+class buffer {
+ public:
+  explicit buffer(std::size_t size) : size_(0) {
+    if (acquire() && size <= block_.capacity) {
+      internal::localStatistics().hits++;
+    }
+    resize(size);
+  }
+
+  buffer(const buffer &) = delete;
+  buffer &operator=(const buffer &) = delete;
+
+  ~buffer() {
+    if (!internal::enabled()) {
+      return;
+    }
+    internal::settings &s = internal::settings::instance();
+    std::vector<internal::block<T>> &pool = internal::localPool<T>();
+    if (block_.capacity <= s.capacity.load(std::memory_order_relaxed) &&
+        pool.size() < s.buffers.load(std::memory_order_relaxed)) {
+      pool.push_back(std::move(block_));
+    } else {
+      internal::localStatistics().discards++;
+    }
+  }
+
+  T *data() { return block_.data.get(); }
+
+  std::size_t size() const { return size_; }
+
+  // Makes room for size characters, dropping the current contents if the
+  // buffer has to grow
+  void resize(std::size_t size) {
+    if (size > block_.capacity) {
+      block_.data.reset(new T[size]);
+      block_.capacity = size;
+      if (internal::enabled()) {
+        internal::localStatistics().misses++;
+      }
+    }
+    size_ = size;
+  }
+
+ private:
+  // Takes the most recently released buffer, if there is one
+  bool acquire() {
+    if (!internal::enabled()) {
+      return false;
+    }
+    std::vector<internal::block<T>> &pool = internal::localPool<T>();
+    if (pool.empty()) {
+      return false;
+    }
+    block_ = std::move(pool.back());
+    pool.pop_back();
+    return true;
+  }
+
+  internal::block<T> block_;
+  std::size_t size_;
+};
+
+}  // namespace scratch
+
+}  // namespace string
+
+}  // namespace util
+
+#endif  // INCLUDE_UTIL_STRING_SCRATCH_HPP_
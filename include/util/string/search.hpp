@@ -0,0 +1,106 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_SEARCH_HPP_
+#define INCLUDE_UTIL_STRING_SEARCH_HPP_
+
+#include <algorithm>
+#include <string>
+
+namespace util {
+
+namespace string {
+
+template <typename T>
+inline bool startsWith(const std::basic_string<T> &haystack,
+                       const std::basic_string<T> &needle) {
+  return (haystack.size() >= needle.size()) &&
+      std::equal(needle.begin(), needle.end(), haystack.begin());
+}
+
+template <typename T>
+inline bool startsWith(const T *haystack, const std::basic_string<T> &needle) {
+  return startsWith(std::basic_string<T>(haystack), needle);
+}
+
+template <typename T>
+inline bool startsWith(const std::basic_string<T> &haystack, const T *needle) {
+  return startsWith(haystack, std::basic_string<T>(needle));
+}
+
+template <typename T>
+inline bool startsWith(const T *haystack, const T *needle) {
+  return startsWith(std::basic_string<T>(haystack),
+                    std::basic_string<T>(needle));
+}
+
+template <typename T>
+inline bool endsWith(const std::basic_string<T> &haystack,
+                     const std::basic_string<T> &needle) {
+  return (haystack.size() >= needle.size()) &&
+      std::equal(needle.rbegin(), needle.rend(), haystack.rbegin());
+}
+
+template <typename T>
+inline bool endsWith(const T *haystack, const std::basic_string<T> &needle) {
+  return endsWith(std::basic_string<T>(haystack), needle);
+}
+
+template <typename T>
+inline bool endsWith(const std::basic_string<T> &haystack, const T *needle) {
+  return endsWith(haystack, std::basic_string<T>(needle));
+}
+
+template <typename T>
+inline bool endsWith(const T *haystack, const T *needle) {
+  return endsWith(std::basic_string<T>(haystack),
+                  std::basic_string<T>(needle));
+}
+
+template <typename T>
+inline bool contains(const std::basic_string<T> &haystack,
+                     const std::basic_string<T> &needle) {
+  return haystack.find(needle) != std::string::npos;
+}
+
+template <typename T>
+inline bool contains(const T *haystack, const std::basic_string<T> &needle) {
+  return contains(std::basic_string<T>(haystack), needle);
+}
+
+template <typename T>
+inline bool contains(const std::basic_string<T> &haystack, const T *needle) {
+  return contains(haystack, std::basic_string<T>(needle));
+}
+
+template <typename T>
+inline bool contains(const T *haystack, const T *needle) {
+  return contains(std::basic_string<T>(haystack), std::basic_string<T>(needle));
+}
+
+}  // namespace string
+
+}  // namespace util
+
+#endif  // INCLUDE_UTIL_STRING_SEARCH_HPP_
@@ -0,0 +1,215 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_SIMD_HPP_
+#define INCLUDE_UTIL_STRING_SIMD_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define UTIL_STRING_HAVE_SSE2 1
+#endif
+
+namespace util {
+
+namespace string {
+
+namespace internal {
+
+#ifdef UTIL_STRING_HAVE_SSE2
+// Mask of the bytes of chunk in [low, high], compared as unsigned
+inline __m128i inRange(__m128i chunk, char low, char high) {
+  const __m128i bias = _mm_set1_epi8(static_cast<char>(0x80));
+  __m128i biased = _mm_xor_si128(chunk, bias);
+  return _mm_andnot_si128(
+      _mm_or_si128(
+          _mm_cmplt_epi8(biased, _mm_set1_epi8(static_cast<char>(low ^ 0x80))),
+          _mm_cmpgt_epi8(biased,
+                         _mm_set1_epi8(static_cast<char>(high ^ 0x80)))),
+      _mm_set1_epi8(static_cast<char>(0xFF)));
+}
+#endif
+
+// Returns the offset of the first byte with the high bit set, or length if
+// every byte is ASCII.
+inline std::size_t findNonAscii(const char *s, std::size_t length) {
+  std::size_t i = 0;
+#ifdef UTIL_STRING_HAVE_SSE2
+  for (; i + 16 <= length; i += 16) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+    int mask = _mm_movemask_epi8(chunk);
+    if (mask != 0) {
+      return i + __builtin_ctz(static_cast<unsigned>(mask));
+    }
+  }
+#else
+  for (; i + 8 <= length; i += 8) {
+    std::uint64_t word;
+    std::memcpy(&word, s + i, sizeof(word));
+    if (word & 0x8080808080808080ULL) {
+      break;
+    }
+  }
+#endif
+  for (; i < length; i++) {
+    if (static_cast<unsigned char>(s[i]) & 0x80) {
+      return i;
+    }
+  }
+  return length;
+}
+
+// Returns the number of leading bytes of s that occur among the count bytes
+// of set. Meant for small sets, since every chunk is compared against each
+// member of the set.
+inline std::size_t spanOf(const char *s, std::size_t length,
+                          const char *set, std::size_t count) {
+  std::size_t i = 0;
+#ifdef UTIL_STRING_HAVE_SSE2
+  for (; i + 16 <= length; i += 16) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+    __m128i hits = _mm_setzero_si128();
+    for (std::size_t j = 0; j < count; j++) {
+      hits = _mm_or_si128(hits, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(set[j])));
+    }
+    unsigned misses = ~static_cast<unsigned>(_mm_movemask_epi8(hits)) & 0xFFFF;
+    if (misses != 0) {
+      return i + __builtin_ctz(misses);
+    }
+  }
+#endif
+  for (; i < length; i++) {
+    if (std::memchr(set, s[i], count) == nullptr) {
+      break;
+    }
+  }
+  return i;
+}
+
+// Returns the number of trailing bytes of s that occur among the count
+// bytes of set.
+inline std::size_t rspanOf(const char *s, std::size_t length,
+                           const char *set, std::size_t count) {
+  std::size_t i = length;
+#ifdef UTIL_STRING_HAVE_SSE2
+  for (; i >= 16; i -= 16) {
+    __m128i chunk = _mm_loadu_si128(
+        reinterpret_cast<const __m128i *>(s + i - 16));
+    __m128i hits = _mm_setzero_si128();
+    for (std::size_t j = 0; j < count; j++) {
+      hits = _mm_or_si128(hits, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(set[j])));
+    }
+    unsigned misses = ~static_cast<unsigned>(_mm_movemask_epi8(hits)) & 0xFFFF;
+    if (misses != 0) {
+      return length - (i - 16 + (31 - __builtin_clz(misses)) + 1);
+    }
+  }
+#endif
+  for (; i > 0; i--) {
+    if (std::memchr(set, s[i - 1], count) == nullptr) {
+      break;
+    }
+  }
+  return length - i;
+}
+
+// Returns the number of leading bytes of s that do not occur among the
+// count bytes of set, i.e. the offset of the first byte that does.
+inline std::size_t cspanOf(const char *s, std::size_t length,
+                           const char *set, std::size_t count) {
+  std::size_t i = 0;
+#ifdef UTIL_STRING_HAVE_SSE2
+  for (; i + 16 <= length; i += 16) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+    __m128i hits = _mm_setzero_si128();
+    for (std::size_t j = 0; j < count; j++) {
+      hits = _mm_or_si128(hits, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(set[j])));
+    }
+    unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hits));
+    if (mask != 0) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+#endif
+  for (; i < length; i++) {
+    if (std::memchr(set, s[i], count) != nullptr) {
+      break;
+    }
+  }
+  return i;
+}
+
+// Generic counterpart of cspanOf for wide characters
+template <typename T>
+inline std::size_t cspanOf(const T *s, std::size_t length,
+                           const T *set, std::size_t count) {
+  std::size_t i = 0;
+  for (; i < length; i++) {
+    if (std::char_traits<T>::find(set, count, s[i]) != nullptr) {
+      break;
+    }
+  }
+  return i;
+}
+
+// Adds delta to every byte of s in the range [low, high]. Used for ASCII
+// case mapping, where delta is +/-0x20; low and high must lie within
+// [0x01, 0x7E].
+inline void shiftRange(char *s, std::size_t length,
+                       char low, char high, char delta) {
+  std::size_t i = 0;
+#ifdef UTIL_STRING_HAVE_SSE2
+  // Bias by 0x80 so that the signed compares act as unsigned ones
+  const __m128i bias = _mm_set1_epi8(static_cast<char>(0x80));
+  const __m128i lower = _mm_set1_epi8(static_cast<char>((low ^ 0x80) - 1));
+  const __m128i upper = _mm_set1_epi8(static_cast<char>((high ^ 0x80) + 1));
+  const __m128i shift = _mm_set1_epi8(delta);
+  for (; i + 16 <= length; i += 16) {
+    auto p = reinterpret_cast<__m128i *>(s + i);
+    __m128i chunk = _mm_loadu_si128(p);
+    __m128i biased = _mm_xor_si128(chunk, bias);
+    __m128i inside = _mm_and_si128(_mm_cmpgt_epi8(biased, lower),
+                                   _mm_cmplt_epi8(biased, upper));
+    chunk = _mm_add_epi8(chunk, _mm_and_si128(inside, shift));
+    _mm_storeu_si128(p, chunk);
+  }
+#endif
+  for (; i < length; i++) {
+    if (s[i] >= low && s[i] <= high) {
+      s[i] = static_cast<char>(s[i] + delta);
+    }
+  }
+}
+
+}  // namespace internal
+
+}  // namespace string
+
+}  // namespace util
+
+#endif  // INCLUDE_UTIL_STRING_SIMD_HPP_
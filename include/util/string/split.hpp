@@ -0,0 +1,105 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_SPLIT_HPP_
+#define INCLUDE_UTIL_STRING_SPLIT_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "util/string/probe.hpp"
+
+namespace util {
+
+namespace string {
+
+template <typename T>
+std::vector<std::basic_string<T>> split(const std::basic_string<T> &s,
+                                        const T delim = ' ') {
+  UTIL_STRING_PROBE(Split, s.size() * sizeof(T));
+  std::vector<std::basic_string<T>> tokens;
+  if (s.empty()) {
+    return UTIL_STRING_PROBE_RETURN(tokens);
+  }
+  // The tokens std::getline would give: every delimiter ends one, and the
+  // text after the last delimiter is one unless it is empty
+  tokens.reserve(std::count(s.begin(), s.end(), delim) +
+                 (s.back() != delim ? 1 : 0));
+  std::size_t start = 0;
+  for (std::size_t end; (end = s.find(delim, start)) !=
+       std::basic_string<T>::npos; start = end + 1) {
+    tokens.emplace_back(s, start, end - start);
+  }
+  if (start < s.size()) {
+    tokens.emplace_back(s, start, std::basic_string<T>::npos);
+  }
+  return UTIL_STRING_PROBE_RETURN(tokens);
+}
+
+template <typename T>
+inline std::vector<std::basic_string<T>> split(const T *s,
+                                               const T delim = ' ') {
+  return split(std::basic_string<T>(s), delim);
+}
+
+template <typename T>
+std::basic_string<T>
+join(const std::vector<std::basic_string<T>> &tokens,
+     const std::basic_string<T> &delim) {
+  UTIL_STRING_PROBE(Join, instrument::internal::payload(tokens));
+  std::basic_string<T> s;
+  for (auto it = tokens.begin(); it != tokens.end(); it++) {
+    s.append(*it);
+    if (it != std::prev(tokens.end())) {
+      s.append(delim);
+    }
+  }
+  return UTIL_STRING_PROBE_RETURN(s);
+}
+
+template <typename T>
+inline std::basic_string<T>
+join(const std::vector<std::basic_string<T>> &tokens, const T *delim) {
+  return join(tokens, std::basic_string<T>(delim));
+}
+
+#define UTIL_STRING_INSTANTIATE_SPLIT(EXTERN, T)                              \
+  EXTERN template std::vector<std::basic_string<T>> split(                    \
+      const std::basic_string<T> &, const T);                                 \
+  EXTERN template std::basic_string<T> join(                                  \
+      const std::vector<std::basic_string<T>> &,                              \
+      const std::basic_string<T> &);
+
+#ifdef UTIL_STRING_EXTERN_TEMPLATES
+UTIL_STRING_INSTANTIATE_SPLIT(extern, char)
+UTIL_STRING_INSTANTIATE_SPLIT(extern, wchar_t)
+#endif
+
+}  // namespace string
+
+}  // namespace util
+
+#endif  // INCLUDE_UTIL_STRING_SPLIT_HPP_
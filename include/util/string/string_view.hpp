@@ -0,0 +1,227 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_STRING_VIEW_HPP_
+#define INCLUDE_UTIL_STRING_STRING_VIEW_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+namespace util {
+
+namespace string {
+
+// A non-owning reference to a contiguous range of characters, for the
+// functions that can hand out parts of their input without copying.
+// It follows the interface of std::basic_string_view and converts to and
+// from it when compiled as C++17.
+template <typename T>
+class basic_string_view {
+ public:
+  typedef T value_type;
+  typedef const T *const_iterator;
+  typedef const T *iterator;
+  typedef std::size_t size_type;
+
+  static const std::size_t npos = static_cast<std::size_t>(-1);
+
+  basic_string_view() : data_(nullptr), size_(0) {
+  }
+
+  basic_string_view(const T *s, std::size_t length)
+      : data_(s), size_(length) {
+  }
+
+  basic_string_view(const T *s)  // NOLINT
+      : data_(s), size_(std::char_traits<T>::length(s)) {
+  }
+
+  basic_string_view(const std::basic_string<T> &s)  // NOLINT
+      : data_(s.data()), size_(s.size()) {
+  }
+
+#if __cplusplus >= 201703L
+  basic_string_view(std::basic_string_view<T> s)  // NOLINT
+      : data_(s.data()), size_(s.size()) {
+  }
+
+  operator std::basic_string_view<T>() const {
+    return std::basic_string_view<T>(data_, size_);
+  }
+#endif
+
+  const T *data() const {
+    return data_;
+  }
+
+  std::size_t size() const {
+    return size_;
+  }
+
+  std::size_t length() const {
+    return size_;
+  }
+
+  bool empty() const {
+    return size_ == 0;
+  }
+
+  const T *begin() const {
+    return data_;
+  }
+
+  const T *end() const {
+    return data_ + size_;
+  }
+
+  const T &operator[](std::size_t pos) const {
+    return data_[pos];
+  }
+
+  const T &front() const {
+    return data_[0];
+  }
+
+  const T &back() const {
+    return data_[size_ - 1];
+  }
+
+  void remove_prefix(std::size_t n) {
+    data_ += n;
+    size_ -= n;
+  }
+
+  void remove_suffix(std::size_t n) {
+    size_ -= n;
+  }
+
+  basic_string_view substr(std::size_t pos = 0,
+                           std::size_t count = npos) const {
+    if (pos > size_) {
+      throw std::out_of_range("basic_string_view::substr");
+    }
+    return basic_string_view(data_ + pos, std::min(count, size_ - pos));
+  }
+
+  std::size_t find(const T ch, std::size_t pos = 0) const {
+    for (; pos < size_; pos++) {
+      if (data_[pos] == ch) {
+        return pos;
+      }
+    }
+    return npos;
+  }
+
+  std::size_t find(basic_string_view needle, std::size_t pos = 0) const {
+    if (pos > size_ || needle.size_ > size_ - pos) {
+      return npos;
+    }
+    auto it = std::search(data_ + pos, data_ + size_,
+                          needle.data_, needle.data_ + needle.size_);
+    return it == end() ? (needle.empty() ? pos : npos) : it - data_;
+  }
+
+  int compare(basic_string_view other) const {
+    int result = std::char_traits<T>::compare(
+        data_, other.data_, std::min(size_, other.size_));
+    if (result != 0) {
+      return result;
+    }
+    return size_ == other.size_ ? 0 : (size_ < other.size_ ? -1 : 1);
+  }
+
+  std::basic_string<T> str() const {
+    return std::basic_string<T>(data_, size_);
+  }
+
+  explicit operator std::basic_string<T>() const {
+    return str();
+  }
+
+ private:
+  const T *data_;
+  std::size_t size_;
+};
+
+template <typename T>
+const std::size_t basic_string_view<T>::npos;
+
+typedef basic_string_view<char> string_view;
+typedef basic_string_view<wchar_t> wstring_view;
+
+template <typename T>
+inline bool operator==(basic_string_view<T> lhs, basic_string_view<T> rhs) {
+  return lhs.size() == rhs.size() && lhs.compare(rhs) == 0;
+}
+
+template <typename T>
+inline bool operator==(basic_string_view<T> lhs, const T *rhs) {
+  return lhs == basic_string_view<T>(rhs);
+}
+
+template <typename T>
+inline bool operator==(const T *lhs, basic_string_view<T> rhs) {
+  return basic_string_view<T>(lhs) == rhs;
+}
+
+template <typename T>
+inline bool operator==(basic_string_view<T> lhs,
+                       const std::basic_string<T> &rhs) {
+  return lhs == basic_string_view<T>(rhs);
+}
+
+template <typename T>
+inline bool operator==(const std::basic_string<T> &lhs,
+                       basic_string_view<T> rhs) {
+  return basic_string_view<T>(lhs) == rhs;
+}
+
+template <typename T>
+inline bool operator!=(basic_string_view<T> lhs, basic_string_view<T> rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename T>
+inline bool operator<(basic_string_view<T> lhs, basic_string_view<T> rhs) {
+  return lhs.compare(rhs) < 0;
+}
+
+template <typename T>
+inline std::basic_ostream<T> &operator<<(std::basic_ostream<T> &os,
+                                         basic_string_view<T> s) {
+  return os.write(s.data(), static_cast<std::streamsize>(s.size()));
+}
+
+}  // namespace string
+
+}  // namespace util
+
+#endif  // INCLUDE_UTIL_STRING_STRING_VIEW_HPP_
@@ -0,0 +1,169 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_TRANSFORM_HPP_
+#define INCLUDE_UTIL_STRING_TRANSFORM_HPP_
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include "util/string/probe.hpp"
+
+namespace util {
+
+namespace string {
+
+template <typename T, class UnaryPredicate>
+inline std::basic_string<T> transform(std::basic_string<T> s,
+                                      UnaryPredicate pred) {
+  UTIL_STRING_PROBE(Transform, s.size() * sizeof(T));
+  std::transform(s.begin(), s.end(), s.begin(), pred);
+  return UTIL_STRING_PROBE_RETURN(s);
+}
+
+template <typename T, class UnaryPredicate>
+inline std::basic_string<T> transform(const T *s,
+                                      UnaryPredicate pred) {
+  return transform(std::basic_string<T>(s), pred);
+}
+
+template <typename T>
+std::basic_string<T> uppercase(const std::basic_string<T> &s) {
+  return transform(s, ::toupper);
+}
+
+template <typename T>
+inline std::basic_string<T> uppercase(const T *s) {
+  return uppercase(std::basic_string<T>(s));
+}
+
+template <typename T>
+std::basic_string<T> lowercase(const std::basic_string<T> &s) {
+  return transform(s, ::tolower);
+}
+
+template <typename T>
+inline std::basic_string<T> lowercase(const T *s) {
+  return lowercase(std::basic_string<T>(s));
+}
+
+template <typename T>
+std::basic_string<T> reverse(const std::basic_string<T>& s) {
+  UTIL_STRING_PROBE(Reverse, s.size() * sizeof(T));
+  return UTIL_STRING_PROBE_RETURN(std::basic_string<T>(s.rbegin(), s.rend()));
+}
+
+template <typename T>
+inline std::basic_string<T> reverse(const T* s) {
+  return reverse(std::basic_string<T>(s));
+}
+
+template <typename T>
+std::basic_string<T> translate(std::basic_string<T> s,
+                               const std::basic_string<T>& from,
+                               const std::basic_string<T>& to) {
+  UTIL_STRING_PROBE(Translate, s.size() * sizeof(T));
+  auto func = [&](const T ch) {
+    auto length = std::min(from.size(), to.size());
+    for (auto i = 0; i < length; i++) {
+      if (ch == from[i]) {
+        return to[i];
+      }
+    } return ch;
+  };
+  std::transform(s.begin(), s.end(), s.begin(), func);
+  return UTIL_STRING_PROBE_RETURN(s);
+}
+
+template <typename T>
+inline std::basic_string<T> translate(const std::basic_string<T>& s,
+                                      const std::basic_string<T>& from,
+                                      const T* to) {
+  return translate(s, from, std::basic_string<T>(to));
+}
+
+template <typename T>
+inline std::basic_string<T> translate(const std::basic_string<T>& s,
+                                      const T* from,
+                                      const std::basic_string<T>& to) {
+  return translate(s, std::basic_string<T>(from), to);
+}
+
+template <typename T>
+inline std::basic_string<T> translate(const T* s,
+                                      const std::basic_string<T>& from,
+                                      const std::basic_string<T>& to) {
+  return translate(std::basic_string<T>(s), from, to);
+}
+
+template <typename T>
+inline std::basic_string<T> translate(const std::basic_string<T>& s,
+                                      const T* from,
+                                      const T* to) {
+  return translate(s, std::basic_string<T>(from), std::basic_string<T>(to));
+}
+
+template <typename T>
+inline std::basic_string<T> translate(const T* s,
+                                      const std::basic_string<T>& from,
+                                      const T* to) {
+  return translate(std::basic_string<T>(s), from, std::basic_string<T>(to));
+}
+
+template <typename T>
+inline std::basic_string<T> translate(const T* s,
+                                      const T* from,
+                                      const std::basic_string<T>& to) {
+  return translate(std::basic_string<T>(s), std::basic_string<T>(from), to);
+}
+
+template <typename T>
+inline std::basic_string<T> translate(const T* s,
+                                      const T* from,
+                                      const T* to) {
+  return translate(std::basic_string<T>(s),
+                   std::basic_string<T>(from),
+                   std::basic_string<T>(to));
+}
+
+#define UTIL_STRING_INSTANTIATE_TRANSFORM(EXTERN, T)                          \
+  EXTERN template std::basic_string<T> uppercase(                             \
+      const std::basic_string<T> &);                                          \
+  EXTERN template std::basic_string<T> lowercase(                             \
+      const std::basic_string<T> &);                                          \
+  EXTERN template std::basic_string<T> reverse(                               \
+      const std::basic_string<T> &);                                          \
+  EXTERN template std::basic_string<T> translate(std::basic_string<T>,        \
+      const std::basic_string<T> &, const std::basic_string<T> &);
+
+#ifdef UTIL_STRING_EXTERN_TEMPLATES
+UTIL_STRING_INSTANTIATE_TRANSFORM(extern, char)
+UTIL_STRING_INSTANTIATE_TRANSFORM(extern, wchar_t)
+#endif
+
+}  // namespace string
+
+}  // namespace util
+
+#endif  // INCLUDE_UTIL_STRING_TRANSFORM_HPP_
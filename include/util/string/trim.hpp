@@ -0,0 +1,205 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_TRIM_HPP_
+#define INCLUDE_UTIL_STRING_TRIM_HPP_
+
+#include <algorithm>
+#include <cwctype>
+#include <iterator>
+#include <string>
+#include "util/string/char_set.hpp"
+#include "util/string/probe.hpp"
+#include "util/string/string_view.hpp"
+
+namespace util {
+
+namespace string {
+
+template <typename T, typename UnaryPredicate>
+inline std::basic_string<T> ltrim(const std::basic_string<T> &s,
+                                  UnaryPredicate pred) {
+  UTIL_STRING_PROBE(Trim, s.size() * sizeof(T));
+  auto first = std::find_if_not(s.begin(), s.end(), pred);
+  auto last = s.end();
+  return UTIL_STRING_PROBE_RETURN(std::basic_string<T>(first, last));
+}
+
+template <typename T>
+std::basic_string<T> ltrim(const std::basic_string<T> &s,
+                           const basic_char_set<T> &set) {
+  UTIL_STRING_PROBE(Trim, s.size() * sizeof(T));
+  return UTIL_STRING_PROBE_RETURN(s.substr(set.span(s.data(), s.size())));
+}
+
+template <typename T>
+inline basic_string_view<T> ltrim(
+    basic_string_view<T> s,
+    const typename internal::identity<basic_char_set<T>>::type &set) {
+  s.remove_prefix(set.span(s.data(), s.size()));
+  return s;
+}
+
+inline std::string ltrim(const std::string& s) {
+  return ltrim(s, whitespace());
+}
+
+inline std::wstring ltrim(const std::wstring& s) {
+  return ltrim(s, [](wchar_t c) { return std::iswspace(c); });
+}
+
+inline std::string ltrim(const std::string& s, const char ch) {
+  return ltrim(s, [&](unsigned char c) { return ch == c; });
+}
+
+inline std::wstring ltrim(const std::wstring& s, const wchar_t ch) {
+  return ltrim(s, [&](wchar_t c) { return ch == c; });
+}
+
+inline std::string ltrim(const std::string& s, const char *chars) {
+  return ltrim(s, char_set(chars));
+}
+
+inline std::wstring ltrim(const std::wstring& s, const wchar_t *chars) {
+  return ltrim(s, wchar_set(chars));
+}
+
+template <typename T, typename UnaryPredicate>
+inline std::basic_string<T> rtrim(const std::basic_string<T> &s,
+                                  UnaryPredicate pred) {
+  UTIL_STRING_PROBE(Trim, s.size() * sizeof(T));
+  auto first = s.begin();
+  auto last = std::find_if_not(s.rbegin(), s.rend(), pred).base();
+  return UTIL_STRING_PROBE_RETURN(std::basic_string<T>(first, last));
+}
+
+template <typename T>
+std::basic_string<T> rtrim(const std::basic_string<T> &s,
+                           const basic_char_set<T> &set) {
+  UTIL_STRING_PROBE(Trim, s.size() * sizeof(T));
+  return UTIL_STRING_PROBE_RETURN(
+      s.substr(0, s.size() - set.rspan(s.data(), s.size())));
+}
+
+template <typename T>
+inline basic_string_view<T> rtrim(
+    basic_string_view<T> s,
+    const typename internal::identity<basic_char_set<T>>::type &set) {
+  s.remove_suffix(set.rspan(s.data(), s.size()));
+  return s;
+}
+
+inline std::string rtrim(const std::string& s) {
+  return rtrim(s, whitespace());
+}
+
+inline std::wstring rtrim(const std::wstring& s) {
+  return rtrim(s, [](wchar_t c) { return std::iswspace(c); });
+}
+
+inline std::string rtrim(const std::string& s, const char ch) {
+  return rtrim(s, [&](unsigned char c) { return ch == c; });
+}
+
+inline std::wstring rtrim(const std::wstring& s, const wchar_t ch) {
+  return rtrim(s, [&](wchar_t c) { return ch == c; });
+}
+
+inline std::string rtrim(const std::string& s, const char *chars) {
+  return rtrim(s, char_set(chars));
+}
+
+inline std::wstring rtrim(const std::wstring& s, const wchar_t *chars) {
+  return rtrim(s, wchar_set(chars));
+}
+
+template <typename T, typename UnaryPredicate>
+inline std::basic_string<T> trim(const std::basic_string<T> &s,
+                                 UnaryPredicate pred) {
+  UTIL_STRING_PROBE(Trim, s.size() * sizeof(T));
+  auto first = std::find_if_not(s.begin(), s.end(), pred);
+  auto last = std::find_if_not(s.rbegin(),
+                               std::reverse_iterator<decltype(first)>(first),
+                               pred).base();
+  return UTIL_STRING_PROBE_RETURN(std::basic_string<T>(first, last));
+}
+
+template <typename T>
+inline basic_string_view<T> trim(
+    basic_string_view<T> s,
+    const typename internal::identity<basic_char_set<T>>::type &set) {
+  s.remove_prefix(set.span(s.data(), s.size()));
+  s.remove_suffix(set.rspan(s.data(), s.size()));
+  return s;
+}
+
+template <typename T>
+std::basic_string<T> trim(const std::basic_string<T> &s,
+                          const basic_char_set<T> &set) {
+  UTIL_STRING_PROBE(Trim, s.size() * sizeof(T));
+  return UTIL_STRING_PROBE_RETURN(trim(basic_string_view<T>(s), set).str());
+}
+
+inline std::string trim(const std::string& s) {
+  return trim(s, whitespace());
+}
+
+inline std::wstring trim(const std::wstring& s) {
+  return trim(s, [](wchar_t c) { return std::iswspace(c); });
+}
+
+inline std::string trim(const std::string& s, const char ch) {
+  return trim(s, [&](unsigned char c) { return ch == c; });
+}
+
+inline std::wstring trim(const std::wstring& s, const wchar_t ch) {
+  return trim(s, [&](wchar_t c) { return ch == c; });
+}
+
+inline std::string trim(const std::string& s, const char *chars) {
+  return trim(s, char_set(chars));
+}
+
+inline std::wstring trim(const std::wstring& s, const wchar_t *chars) {
+  return trim(s, wchar_set(chars));
+}
+
+#define UTIL_STRING_INSTANTIATE_TRIM(EXTERN, T)                               \
+  EXTERN template std::basic_string<T> ltrim(const std::basic_string<T> &,    \
+      const basic_char_set<T> &);                                             \
+  EXTERN template std::basic_string<T> rtrim(const std::basic_string<T> &,    \
+      const basic_char_set<T> &);                                             \
+  EXTERN template std::basic_string<T> trim(const std::basic_string<T> &,     \
+      const basic_char_set<T> &);
+
+#ifdef UTIL_STRING_EXTERN_TEMPLATES
+UTIL_STRING_INSTANTIATE_TRIM(extern, char)
+UTIL_STRING_INSTANTIATE_TRIM(extern, wchar_t)
+#endif
+
+}  // namespace string
+
+}  // namespace util
+
+#endif  // INCLUDE_UTIL_STRING_TRIM_HPP_
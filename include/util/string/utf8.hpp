@@ -0,0 +1,344 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INCLUDE_UTIL_STRING_UTF8_HPP_
+#define INCLUDE_UTIL_STRING_UTF8_HPP_
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include "util/string/simd.hpp"
+#include "util/string/transform.hpp"
+
+namespace util {
+
+namespace string {
+
+// Codepoint-aware counterparts of the byte routines for UTF-8 encoded
+// std::string. Every function checks its input and throws
+// std::invalid_argument on malformed UTF-8. All-ASCII input is detected with
+// a vectorized scan and handed to the existing byte routines unchanged.
+namespace utf8 {
+
+namespace internal {
+
+inline std::size_t sequenceLength(const unsigned char lead) {
+  if (lead < 0x80) {
+    return 1;
+  } else if ((lead & 0xE0) == 0xC0) {
+    return 2;
+  } else if ((lead & 0xF0) == 0xE0) {
+    return 3;
+  }
+  return 4;
+}
+
+// Returns the length of the valid sequence at p, or 0 if it is malformed.
+// Rejects overlong forms, surrogates and codepoints above U+10FFFF.
+inline std::size_t validSequence(const unsigned char *p,
+                                 const unsigned char *end) {
+  const unsigned char lead = p[0];
+  unsigned char low = 0x80;
+  unsigned char high = 0xBF;
+  std::size_t length;
+  if (lead < 0x80) {
+    return 1;
+  } else if (lead >= 0xC2 && lead <= 0xDF) {
+    length = 2;
+  } else if (lead >= 0xE0 && lead <= 0xEF) {
+    length = 3;
+    if (lead == 0xE0) {
+      low = 0xA0;
+    } else if (lead == 0xED) {
+      high = 0x9F;
+    }
+  } else if (lead >= 0xF0 && lead <= 0xF4) {
+    length = 4;
+    if (lead == 0xF0) {
+      low = 0x90;
+    } else if (lead == 0xF4) {
+      high = 0x8F;
+    }
+  } else {
+    return 0;
+  }
+  if (static_cast<std::size_t>(end - p) < length ||
+      p[1] < low || p[1] > high) {
+    return 0;
+  }
+  for (std::size_t i = 2; i < length; i++) {
+    if ((p[i] & 0xC0) != 0x80) {
+      return 0;
+    }
+  }
+  return length;
+}
+
+inline char32_t decode(const char *s, std::size_t length) {
+  auto p = reinterpret_cast<const unsigned char *>(s);
+  switch (length) {
+    case 1:
+      return p[0];
+    case 2:
+      return ((p[0] & 0x1F) << 6) | (p[1] & 0x3F);
+    case 3:
+      return ((p[0] & 0x0F) << 12) | ((p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+    default:
+      return ((p[0] & 0x07) << 18) | ((p[1] & 0x3F) << 12) |
+          ((p[2] & 0x3F) << 6) | (p[3] & 0x3F);
+  }
+}
+
+inline void encode(char32_t cp, std::string &out) {
+  if (cp < 0x80) {
+    out.push_back(static_cast<char>(cp));
+  } else if (cp < 0x800) {
+    out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+    out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+  } else if (cp < 0x10000) {
+    out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+    out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+  } else {
+    out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+    out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+  }
+}
+
+// Returns true if the string is all ASCII, false if it is valid UTF-8 with
+// at least one multibyte sequence, and throws if it is not valid UTF-8.
+inline bool checkAscii(const std::string &s) {
+  const char *data = s.data();
+  std::size_t length = s.size();
+  std::size_t i = util::string::internal::findNonAscii(data, length);
+  if (i == length) {
+    return true;
+  }
+  auto p = reinterpret_cast<const unsigned char *>(data);
+  while (i < length) {
+    if (p[i] < 0x80) {
+      i += util::string::internal::findNonAscii(data + i, length - i);
+      continue;
+    }
+    std::size_t n = validSequence(p + i, p + length);
+    if (n == 0) {
+      throw std::invalid_argument("invalid UTF-8 sequence");
+    }
+    i += n;
+  }
+  return false;
+}
+
+inline bool isSpace(char32_t cp) {
+  return (cp >= 0x09 && cp <= 0x0D) || cp == 0x20 || cp == 0x85 ||
+      cp == 0xA0 || cp == 0x1680 || (cp >= 0x2000 && cp <= 0x200A) ||
+      cp == 0x2028 || cp == 0x2029 || cp == 0x202F || cp == 0x205F ||
+      cp == 0x3000;
+}
+
+// Simple one-to-one case mapping for the Latin, Greek, Cyrillic, Armenian
+// and fullwidth Latin blocks. Codepoints outside them map to themselves.
+inline char32_t toUpper(char32_t cp) {
+  if (cp >= 'a' && cp <= 'z') {
+    return cp - 0x20;
+  } else if ((cp >= 0xE0 && cp <= 0xFE && cp != 0xF7) ||
+             (cp >= 0x3B1 && cp <= 0x3CB && cp != 0x3C2) ||
+             (cp >= 0x430 && cp <= 0x44F) ||
+             (cp >= 0xFF41 && cp <= 0xFF5A)) {
+    return cp - 0x20;
+  } else if (cp == 0xFF) {
+    return 0x178;
+  } else if (cp == 0x3C2) {
+    return 0x3A3;
+  } else if (cp >= 0x450 && cp <= 0x45F) {
+    return cp - 0x50;
+  } else if (cp >= 0x561 && cp <= 0x586) {
+    return cp - 0x30;
+  } else if ((cp >= 0x100 && cp <= 0x12F) || (cp >= 0x132 && cp <= 0x137) ||
+             (cp >= 0x14A && cp <= 0x177) || (cp >= 0x460 && cp <= 0x481) ||
+             (cp >= 0x48A && cp <= 0x4BF) || (cp >= 0x4D0 && cp <= 0x52F)) {
+    return cp & ~static_cast<char32_t>(1);
+  } else if ((cp >= 0x139 && cp <= 0x148) || (cp >= 0x179 && cp <= 0x17E) ||
+             (cp >= 0x4C1 && cp <= 0x4CE)) {
+    return (cp & 1) ? cp : cp - 1;
+  }
+  return cp;
+}
+
+inline char32_t toLower(char32_t cp) {
+  if (cp >= 'A' && cp <= 'Z') {
+    return cp + 0x20;
+  } else if ((cp >= 0xC0 && cp <= 0xDE && cp != 0xD7) ||
+             (cp >= 0x391 && cp <= 0x3AB && cp != 0x3A2) ||
+             (cp >= 0x410 && cp <= 0x42F) ||
+             (cp >= 0xFF21 && cp <= 0xFF3A)) {
+    return cp + 0x20;
+  } else if (cp == 0x178) {
+    return 0xFF;
+  } else if (cp >= 0x400 && cp <= 0x40F) {
+    return cp + 0x50;
+  } else if (cp >= 0x531 && cp <= 0x556) {
+    return cp + 0x30;
+  } else if ((cp >= 0x100 && cp <= 0x12F) || (cp >= 0x132 && cp <= 0x137) ||
+             (cp >= 0x14A && cp <= 0x177) || (cp >= 0x460 && cp <= 0x481) ||
+             (cp >= 0x48A && cp <= 0x4BF) || (cp >= 0x4D0 && cp <= 0x52F)) {
+    return cp | 1;
+  } else if ((cp >= 0x139 && cp <= 0x148) || (cp >= 0x179 && cp <= 0x17E) ||
+             (cp >= 0x4C1 && cp <= 0x4CE)) {
+    return (cp & 1) ? cp + 1 : cp;
+  }
+  return cp;
+}
+
+template <typename CaseMap>
+inline std::string mapCase(const std::string &s, CaseMap map) {
+  std::string out;
+  out.reserve(s.size());
+  const char *p = s.data();
+  const char *end = p + s.size();
+  while (p != end) {
+    std::size_t ascii = util::string::internal::findNonAscii(p, end - p);
+    for (std::size_t i = 0; i < ascii; i++) {
+      out.push_back(static_cast<char>(map(static_cast<unsigned char>(p[i]))));
+    }
+    p += ascii;
+    if (p == end) {
+      break;
+    }
+    std::size_t n = sequenceLength(static_cast<unsigned char>(*p));
+    encode(map(decode(p, n)), out);
+    p += n;
+  }
+  return out;
+}
+
+// Returns the end of the leading whitespace of valid UTF-8 s
+inline std::size_t spaceSpan(const std::string &s) {
+  std::size_t i = 0;
+  while (i < s.size()) {
+    std::size_t n = sequenceLength(static_cast<unsigned char>(s[i]));
+    if (!isSpace(decode(&s[i], n))) {
+      break;
+    }
+    i += n;
+  }
+  return i;
+}
+
+// Returns the start of the trailing whitespace of valid UTF-8 s, not
+// looking before first
+inline std::size_t spaceRspan(const std::string &s, std::size_t first) {
+  std::size_t i = s.size();
+  while (i > first) {
+    std::size_t start = i - 1;
+    while ((static_cast<unsigned char>(s[start]) & 0xC0) == 0x80) {
+      start--;
+    }
+    if (!isSpace(decode(&s[start], i - start))) {
+      break;
+    }
+    i = start;
+  }
+  return i;
+}
+
+}  // namespace internal
+
+inline bool isAscii(const std::string &s) {
+  return util::string::internal::findNonAscii(s.data(), s.size()) == s.size();
+}
+
+inline bool isValid(const std::string &s) {
+  try {
+    internal::checkAscii(s);
+  } catch (const std::invalid_argument &) {
+    return false;
+  }
+  return true;
+}
+
+inline std::size_t length(const std::string &s) {
+  if (internal::checkAscii(s)) {
+    return s.size();
+  }
+  std::size_t count = 0;
+  for (const char ch : s) {
+    count += (static_cast<unsigned char>(ch) & 0xC0) != 0x80;
+  }
+  return count;
+}
+
+inline std::string reverse(const std::string &s) {
+  if (internal::checkAscii(s)) {
+    return util::string::reverse(s);
+  }
+  std::string out(s.size(), '\0');
+  std::size_t i = 0;
+  while (i < s.size()) {
+    std::size_t n = internal::sequenceLength(static_cast<unsigned char>(s[i]));
+    s.copy(&out[s.size() - i - n], n, i);
+    i += n;
+  }
+  return out;
+}
+
+inline std::string ltrim(const std::string &s) {
+  internal::checkAscii(s);
+  return s.substr(internal::spaceSpan(s));
+}
+
+inline std::string rtrim(const std::string &s) {
+  internal::checkAscii(s);
+  return s.substr(0, internal::spaceRspan(s, 0));
+}
+
+inline std::string trim(const std::string &s) {
+  internal::checkAscii(s);
+  std::size_t first = internal::spaceSpan(s);
+  return s.substr(first, internal::spaceRspan(s, first) - first);
+}
+
+inline std::string uppercase(const std::string &s) {
+  if (internal::checkAscii(s)) {
+    return util::string::uppercase(s);
+  }
+  return internal::mapCase(s, internal::toUpper);
+}
+
+inline std::string lowercase(const std::string &s) {
+  if (internal::checkAscii(s)) {
+    return util::string::lowercase(s);
+  }
+  return internal::mapCase(s, internal::toLower);
+}
+
+}  // namespace utf8
+
+}  // namespace string
+
+}  // namespace util
+
+#endif  // INCLUDE_UTIL_STRING_UTF8_HPP_
@@ -0,0 +1,35 @@
+#!/bin/sh
+# Copyright (c) 2020 LG Electronics Inc.
+# SPDX-License-Identifier: MIT
+#
+# Times the compilation of the build-time benchmark's translation units
+# against the header-only interface and against the compiled util library,
+# whose extern templates spare every unit the common instantiations.
+#
+#   scripts/build_benchmark.sh [build-dir]
+#
+# BUILD_TYPE (default Debug), UNITS (default 40) and JOBS (default: the
+# number of processors) tune the run.
+
+set -e
+
+SOURCE_DIR=$(cd "$(dirname "$0")/.." && pwd)
+BUILD_DIR=${1:-"${TMPDIR:-/tmp}/util-build-benchmark"}
+JOBS=${JOBS:-$(nproc)}
+
+cmake -S "$SOURCE_DIR" -B "$BUILD_DIR" \
+  -DCMAKE_BUILD_TYPE="${BUILD_TYPE:-Debug}" \
+  -DENABLE_BUILD_BENCHMARK=ON \
+  -DBUILD_BENCHMARK_UNITS="${UNITS:-40}" > /dev/null
+cmake --build "$BUILD_DIR" --target util -j "$JOBS" > /dev/null
+
+for TARGET in build_benchmark_headers build_benchmark_compiled; do
+  find "$BUILD_DIR" -path "*/$TARGET.dir/*" -name '*.o' -delete
+  START=$(date +%s.%N)
+  cmake --build "$BUILD_DIR" --target "$TARGET" -j "$JOBS" > /dev/null
+  END=$(date +%s.%N)
+  BYTES=$(find "$BUILD_DIR" -path "*/$TARGET.dir/*" -name '*.o' \
+    -exec cat {} + | wc -c)
+  awk -v t="$TARGET" -v s="$START" -v e="$END" -v b="$BYTES" \
+    'BEGIN { printf "%-26s %6.2f s %8d KiB of objects\n", t, e - s, b / 1024 }'
+done
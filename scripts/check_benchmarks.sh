@@ -0,0 +1,67 @@
+#!/bin/sh
+# Copyright (c) 2020 LG Electronics Inc.
+# SPDX-License-Identifier: MIT
+#
+# Runs the benchmarks and compares their throughput with a recorded
+# baseline, failing when any of them dropped by more than a threshold.
+#
+#   scripts/check_benchmarks.sh [-t percent] [-u] benchmarks.bin baseline.csv
+#
+# -t is the tolerated drop in percent (default: THRESHOLD, or 10) and -u
+# records a new baseline instead of comparing against it. Every benchmark
+# runs REPETITIONS (default 5) times and the medians are compared, as bytes
+# per second where a benchmark reports them and as CPU time otherwise.
+
+set -e
+
+THRESHOLD=${THRESHOLD:-10}
+UPDATE=
+while getopts t:u OPTION; do
+  case $OPTION in
+    t) THRESHOLD=$OPTARG ;;
+    u) UPDATE=1 ;;
+    *) exit 2 ;;
+  esac
+done
+shift $((OPTIND - 1))
+
+if [ $# -ne 2 ]; then
+  echo "usage: $0 [-t percent] [-u] benchmarks.bin baseline.csv" >&2
+  exit 2
+fi
+BENCHMARKS=$1
+BASELINE=$2
+
+CURRENT=$(mktemp)
+trap 'rm -f "$CURRENT"' EXIT
+
+"$BENCHMARKS" --benchmark_repetitions="${REPETITIONS:-5}" \
+  --benchmark_report_aggregates_only=true \
+  --benchmark_out="$CURRENT" --benchmark_out_format=csv > /dev/null
+
+if [ -n "$UPDATE" ] || [ ! -f "$BASELINE" ]; then
+  grep '^"[^"]*_median"' "$CURRENT" > "$BASELINE"
+  echo "recorded baseline $BASELINE"
+  exit 0
+fi
+
+# Fields: 1 name, 4 cpu_time, 6 bytes_per_second
+awk -F, -v threshold="$THRESHOLD" '
+  function rate() { return $6 != "" ? $6 : 1 / $4 }
+  !/^"[^"]*_median"/ { next }
+  NR == FNR { baseline[$1] = rate(); next }
+  $1 in baseline {
+    change = (rate() / baseline[$1] - 1) * 100
+    failed = change < -threshold
+    failures += failed
+    name = $1
+    gsub(/"|_median/, "", name)
+    printf "%-24s %+7.1f%%%s\n", name, change, failed ? "  REGRESSION" : ""
+  }
+  END {
+    if (failures) {
+      printf "%d benchmark(s) slower than the baseline by more than %s%%\n",
+             failures, threshold
+      exit 1
+    }
+  }' "$BASELINE" "$CURRENT"
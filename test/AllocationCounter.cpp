@@ -0,0 +1,132 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "AllocationCounter.hpp"
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+struct Counts {
+  std::size_t allocations;
+  std::size_t deallocations;
+  std::size_t bytes;
+};
+
+// Plain zero-initialized data, so that it is usable before any constructor
+// runs and during thread teardown.
+thread_local Counts counts;
+
+void *allocate(std::size_t size) {
+  counts.allocations++;
+  counts.bytes += size;
+  void *p = std::malloc(size == 0 ? 1 : size);
+  if (p == nullptr) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void deallocate(void *p) {
+  if (p != nullptr) {
+    counts.deallocations++;
+    std::free(p);
+  }
+}
+
+}  // namespace
+
+void *operator new(std::size_t size) {
+  return allocate(size);
+}
+
+void *operator new[](std::size_t size) {
+  return allocate(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+  try {
+    return allocate(size);
+  } catch (const std::bad_alloc &) {
+    return nullptr;
+  }
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+  try {
+    return allocate(size);
+  } catch (const std::bad_alloc &) {
+    return nullptr;
+  }
+}
+
+void operator delete(void *p) noexcept {
+  deallocate(p);
+}
+
+void operator delete[](void *p) noexcept {
+  deallocate(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+  deallocate(p);
+}
+
+void operator delete[](void *p, std::size_t) noexcept {
+  deallocate(p);
+}
+
+void operator delete(void *p, const std::nothrow_t &) noexcept {
+  deallocate(p);
+}
+
+void operator delete[](void *p, const std::nothrow_t &) noexcept {
+  deallocate(p);
+}
+
+AllocationCounter::AllocationCounter() {
+  reset();
+}
+
+std::size_t AllocationCounter::allocations() const {
+  return counts.allocations - allocations_;
+}
+
+std::size_t AllocationCounter::deallocations() const {
+  return counts.deallocations - deallocations_;
+}
+
+std::size_t AllocationCounter::bytes() const {
+  return counts.bytes - bytes_;
+}
+
+void AllocationCounter::reset() {
+  allocations_ = counts.allocations;
+  deallocations_ = counts.deallocations;
+  bytes_ = counts.bytes;
+}
+
+std::size_t AllocationCounter::totalAllocations() {
+  return counts.allocations;
+}
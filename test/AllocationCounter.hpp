@@ -0,0 +1,61 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef TEST_ALLOCATIONCOUNTER_HPP_
+#define TEST_ALLOCATIONCOUNTER_HPP_
+
+#include <cstddef>
+
+// Counts the calls to the global operator new and delete made by the
+// current thread, which AllocationCounter.cpp replaces for the whole binary.
+class AllocationCounter {
+ public:
+  AllocationCounter();
+
+  std::size_t allocations() const;
+
+  std::size_t deallocations() const;
+
+  std::size_t bytes() const;
+
+  void reset();
+
+  static std::size_t totalAllocations();
+
+ private:
+  std::size_t allocations_;
+  std::size_t deallocations_;
+  std::size_t bytes_;
+};
+
+// Expects the statement to call operator new exactly `expected` times
+#define EXPECT_ALLOCATIONS(expected, statement)                         \
+  do {                                                                  \
+    AllocationCounter counter_;                                         \
+    statement;                                                          \
+    EXPECT_EQ(static_cast<std::size_t>(expected), counter_.allocations()) \
+        << #statement;                                                  \
+  } while (0)
+
+#endif  // TEST_ALLOCATIONCOUNTER_HPP_
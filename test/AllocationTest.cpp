@@ -0,0 +1,153 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "AllocationCounter.hpp"
+#include "util/string.hpp"
+#include "util/string/distance.hpp"
+#include "util/string/instrument.hpp"
+#include "util/string/pipeline.hpp"
+
+// Pins down how many times each function calls operator new, so that an
+// extra temporary shows up as a test failure. Inputs are either short
+// enough for the small string buffer or clearly longer than it.
+class AllocationTest : public ::testing::Test {
+ protected:
+  const std::string SHORT = "hello world";
+  const std::string LONG = "  the quick brown fox jumps over the lazy dog  ";
+  const std::string LONG_PREFIX = "  the quick brown fox jumps";
+
+#ifdef UTIL_STRING_INSTRUMENTATION
+  // The first probe on a thread allocates its counter slots; pay for that
+  // before anything is counted
+  void SetUp() override {
+    util::string::instrument::reset();
+  }
+#endif
+};
+
+TEST_F(AllocationTest, testCounterSeesAllocations) {
+  AllocationCounter counter;
+  std::unique_ptr<int> p(new int(1));
+  EXPECT_EQ(1, counter.allocations());
+  EXPECT_EQ(sizeof(int), counter.bytes());
+  p.reset();
+  EXPECT_EQ(1, counter.deallocations());
+}
+
+TEST_F(AllocationTest, testPredicatesDoNotAllocate) {
+  EXPECT_ALLOCATIONS(0, util::string::startsWith(LONG, LONG_PREFIX));
+  EXPECT_ALLOCATIONS(0, util::string::startsWith(SHORT, "hello"));
+  EXPECT_ALLOCATIONS(0, util::string::endsWith(LONG, LONG_PREFIX));
+  EXPECT_ALLOCATIONS(0, util::string::endsWith(SHORT, "world"));
+  EXPECT_ALLOCATIONS(0, util::string::contains(LONG, LONG_PREFIX));
+  EXPECT_ALLOCATIONS(0, util::string::contains(SHORT, "o w"));
+}
+
+TEST_F(AllocationTest, testPredicatesWithLongLiteral) {
+  // The literal is copied into a temporary std::string
+  EXPECT_ALLOCATIONS(1, util::string::startsWith(LONG, LONG_PREFIX.c_str()));
+  EXPECT_ALLOCATIONS(1, util::string::endsWith(LONG, LONG_PREFIX.c_str()));
+  EXPECT_ALLOCATIONS(1, util::string::contains(LONG, LONG_PREFIX.c_str()));
+}
+
+TEST_F(AllocationTest, testTransformsAllocateOnlyTheResult) {
+  EXPECT_ALLOCATIONS(0, util::string::uppercase(SHORT));
+  EXPECT_ALLOCATIONS(1, util::string::uppercase(LONG));
+  EXPECT_ALLOCATIONS(1, util::string::lowercase(LONG));
+  EXPECT_ALLOCATIONS(1, util::string::reverse(LONG));
+  EXPECT_ALLOCATIONS(1, util::string::translate(LONG, "abc", "xyz"));
+  EXPECT_ALLOCATIONS(1, util::string::replace(LONG, 'o', '0'));
+  EXPECT_ALLOCATIONS(1, util::string::replace(LONG, "o", "0"));
+}
+
+TEST_F(AllocationTest, testReplaceGrowingResult) {
+  // One copy of the input, one reallocation as it grows
+  EXPECT_ALLOCATIONS(2, util::string::replace(LONG, "o", "00"));
+}
+
+TEST_F(AllocationTest, testTrimAllocatesOnlyTheResult) {
+  EXPECT_ALLOCATIONS(0, util::string::trim(SHORT));
+  EXPECT_ALLOCATIONS(1, util::string::trim(LONG));
+  EXPECT_ALLOCATIONS(1, util::string::ltrim(LONG));
+  EXPECT_ALLOCATIONS(1, util::string::rtrim(LONG));
+  EXPECT_ALLOCATIONS(1, util::string::trim(LONG, ' '));
+  EXPECT_ALLOCATIONS(0, util::string::trim(util::string::string_view(LONG),
+                                           util::string::whitespace()));
+}
+
+TEST_F(AllocationTest, testTrimViewWithScalarSets) {
+  // More members than the SSE2 scan takes, and a wide set
+  const util::string::char_set LETTERS(" abcdefghijklmnopqrstuvwxy");
+  EXPECT_ALLOCATIONS(0, util::string::trim(util::string::string_view(LONG),
+                                           LETTERS));
+  const std::wstring WIDE = L"  the quick brown fox jumps over the lazy dog  ";
+  const util::string::wchar_set BLANKS(L" \t\r\n");
+  EXPECT_ALLOCATIONS(0, util::string::trim(util::string::wstring_view(WIDE),
+                                           BLANKS));
+}
+
+TEST_F(AllocationTest, testFormat) {
+  // The snprintf buffer and the result
+  EXPECT_ALLOCATIONS(2, util::string::format("%s %d", LONG, 42));
+}
+
+TEST_F(AllocationTest, testSplit) {
+  // The vector is sized up front, short tokens stay inline
+  EXPECT_ALLOCATIONS(1, util::string::split(SHORT, ' '));
+  EXPECT_ALLOCATIONS(1, util::string::split(std::string("a b c"), ' '));
+  EXPECT_ALLOCATIONS(0, util::string::split(std::string(), ' '));
+}
+
+TEST_F(AllocationTest, testJoin) {
+  const std::vector<std::string> SHORT_TOKENS = {"a", "b", "c"};
+  const std::vector<std::string> LONG_TOKENS = {LONG, LONG};
+  EXPECT_ALLOCATIONS(0, util::string::join(SHORT_TOKENS, ","));
+  // The result grows once per append, as nothing is reserved up front
+  EXPECT_ALLOCATIONS(3, util::string::join(LONG_TOKENS, ","));
+}
+
+TEST_F(AllocationTest, testPipelineIntoReservedBuffer) {
+  auto pipeline = util::string::stage::trim() |
+      util::string::stage::lowercase() |
+      util::string::stage::replace("o", "0");
+  std::string out;
+  out.reserve(LONG.size());
+  EXPECT_ALLOCATIONS(0, pipeline.appendTo(LONG, out));
+  EXPECT_EQ("the quick br0wn f0x jumps 0ver the lazy d0g", out);
+}
+
+TEST_F(AllocationTest, testDistancesUpTo256Characters) {
+  const std::string A = std::string(128, 'a') + std::string(128, 'b');
+  const std::string B = std::string(128, 'b') + std::string(128, 'a');
+  EXPECT_ALLOCATIONS(0, util::string::levenshtein(A, B));
+  EXPECT_ALLOCATIONS(0, util::string::damerauLevenshtein(A, B));
+  EXPECT_ALLOCATIONS(0, util::string::jaroWinkler(A, B));
+  // Only the copy of the query itself
+  EXPECT_ALLOCATIONS(1, util::string::distance_query query(A));
+  const util::string::distance_query query(A);
+  EXPECT_ALLOCATIONS(0, query.levenshtein(B));
+}
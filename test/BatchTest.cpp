@@ -0,0 +1,90 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "util/string.hpp"
+#include "util/string/batch.hpp"
+
+
+class BatchTest : public ::testing::Test {
+};
+
+TEST_F(BatchTest, testArena) {
+  util::string::arena arena;
+  EXPECT_TRUE(arena.empty());
+  arena.push_back("hello");
+  arena.push_back("");
+  arena.push_back(std::string("world"));
+  ASSERT_EQ(3, arena.size());
+  EXPECT_EQ("hello", arena[0]);
+  EXPECT_EQ("", arena[1]);
+  EXPECT_EQ("world", arena[2]);
+  EXPECT_EQ("helloworld", arena.buffer());
+  arena.clear();
+  EXPECT_TRUE(arena.empty());
+}
+
+TEST_F(BatchTest, testApplyChainForString) {
+  const std::vector<std::string> INPUTS = {
+    "  Hello World  ", "\tABBA\n", "", "   ", "Already clean",
+    "  A LONG STRING THAT SPANS SEVERAL SIMD CHUNKS  "};
+  util::string::arena arena;
+  util::string::batch::apply(INPUTS, arena,
+                             util::string::batch::trim(),
+                             util::string::batch::lowercase(),
+                             util::string::batch::replace("a", "<>"));
+  ASSERT_EQ(INPUTS.size(), arena.size());
+  for (std::size_t i = 0; i < INPUTS.size(); i++) {
+    EXPECT_EQ(util::string::replace(util::string::lowercase(
+        util::string::trim(INPUTS[i])), "a", "<>"), arena[i]);
+  }
+}
+
+TEST_F(BatchTest, testApplyAppendsToArena) {
+  const std::vector<const char *> FIRST = {"abc", "def"};
+  const std::vector<std::string> SECOND = {" ghi "};
+  util::string::arena arena;
+  util::string::batch::apply(FIRST, arena, util::string::batch::uppercase());
+  util::string::batch::apply(SECOND, arena,
+                             util::string::batch::trim(" "),
+                             util::string::batch::translate("gh", "GH"));
+  ASSERT_EQ(3, arena.size());
+  EXPECT_EQ("ABC", arena[0]);
+  EXPECT_EQ("DEF", arena[1]);
+  EXPECT_EQ("GHi", arena[2]);
+}
+
+TEST_F(BatchTest, testApplyChainForWString) {
+  const std::vector<std::wstring> INPUTS = {L" Hello ", L"WORLD"};
+  util::string::warena arena;
+  util::string::batch::apply(INPUTS, arena,
+                             util::string::batch::trim(L" "),
+                             util::string::batch::uppercase(),
+                             util::string::batch::replace(L"L", L""));
+  ASSERT_EQ(2, arena.size());
+  EXPECT_EQ(L"HEO", arena[0]);
+  EXPECT_EQ(L"WORD", arena[1]);
+}
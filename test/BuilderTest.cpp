@@ -0,0 +1,187 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "AllocationCounter.hpp"
+#include "util/string/builder.hpp"
+
+using util::string::string_builder;
+using util::string::string_view;
+using util::string::wstring_builder;
+
+
+class BuilderTest : public ::testing::Test {
+ protected:
+  std::string readAll(std::FILE *file) {
+    std::rewind(file);
+    std::string s;
+    char buf[4096];
+    std::size_t n;
+    while ((n = std::fread(buf, 1, sizeof(buf), file)) > 0) {
+      s.append(buf, n);
+    }
+    return s;
+  }
+};
+
+TEST_F(BuilderTest, testAppend) {
+  string_builder b;
+  EXPECT_TRUE(b.empty());
+  b.append("hello").append(' ').append(std::string("world"))
+      .append(string_view("!!!", 1)).append(3, '.');
+  EXPECT_EQ("hello world!...", b.str());
+  EXPECT_EQ(15, b.size());
+  // Copied pieces that follow each other share one segment
+  EXPECT_EQ(1, b.segments().size());
+}
+
+TEST_F(BuilderTest, testStreamOperators) {
+  string_builder b;
+  b << "a" << std::string("b") << string_view("c") << 'd';
+  EXPECT_EQ("abcd", b.str());
+}
+
+TEST_F(BuilderTest, testAppendRef) {
+  const std::string header = "HTTP/1.1 200 OK\r\n";
+  string_builder b;
+  b.appendRef(header).append("body");
+  ASSERT_EQ(2, b.segments().size());
+  EXPECT_EQ(header.data(), b.segments()[0].data());
+  EXPECT_EQ(header + "body", b.str());
+}
+
+TEST_F(BuilderTest, testAppendFormat) {
+  string_builder b;
+  b.appendFormat("%s=%d", std::string("answer"), 42).append(';');
+  EXPECT_EQ("answer=42;", b.str());
+  const std::string LONG(5000, 'x');
+  b.appendFormat("[%s]", LONG);
+  EXPECT_EQ("answer=42;[" + LONG + "]", b.str());
+}
+
+TEST_F(BuilderTest, testAppendFormatWide) {
+  wstring_builder b;
+  const std::wstring LONG(5000, L'x');
+  b.appendFormat(L"%d:", 7).appendFormat(L"%ls", LONG);
+  EXPECT_EQ(L"7:" + LONG, b.str());
+}
+
+TEST_F(BuilderTest, testAppendFormatThrowsForUnconvertibleArguments) {
+  // Neither converts in the "C" locale; the one allocation is the message
+  string_builder b;
+  b.append("kept");
+  EXPECT_ALLOCATIONS(1, EXPECT_THROW(b.appendFormat("%ls", L"\u00e9"),
+                                     std::invalid_argument));
+  EXPECT_EQ(4, b.size());
+  EXPECT_EQ(1, b.segments().size());
+  EXPECT_EQ("kept", b.str());
+
+  wstring_builder w;
+  w.append(L"kept");
+  EXPECT_THROW(w.appendFormat(L"%s", "\xff"), std::invalid_argument);
+  EXPECT_EQ(4, w.size());
+  EXPECT_EQ(1, w.segments().size());
+  EXPECT_EQ(L"kept", w.str());
+}
+
+TEST_F(BuilderTest, testAppendJoin) {
+  const std::vector<std::string> tokens = {"a", "b", "c"};
+  string_builder b;
+  b.appendJoin(tokens, ", ").appendJoin(std::vector<std::string>(), ",");
+  EXPECT_EQ("a, b, c", b.str());
+}
+
+TEST_F(BuilderTest, testExistingContentNeverMoves) {
+  string_builder b;
+  b.append("first");
+  const char *first = b.segments()[0].data();
+  for (int i = 0; i < 100000; i++) {
+    b.append("0123456789");
+  }
+  EXPECT_EQ(first, b.segments()[0].data());
+  EXPECT_EQ(5 + 100000 * 10, b.size());
+  EXPECT_EQ(std::string("first0123"), b.str().substr(0, 9));
+}
+
+TEST_F(BuilderTest, testChunksGrowGeometrically) {
+  string_builder b;
+  AllocationCounter counter;
+  for (int i = 0; i < 100000; i++) {
+    b.append("0123456789");
+  }
+  // A megabyte in chunks of 1K, 2K, ... plus the segment vector
+  EXPECT_LT(counter.allocations(), 30);
+}
+
+TEST_F(BuilderTest, testStrAllocatesOnce) {
+  string_builder b;
+  for (int i = 0; i < 1000; i++) {
+    b.append("0123456789");
+  }
+  EXPECT_ALLOCATIONS(1, b.str());
+}
+
+TEST_F(BuilderTest, testMoveLeavesSourceEmpty) {
+  string_builder a;
+  a.append("moved");
+  string_builder b(std::move(a));
+  a.append("fresh");
+  EXPECT_EQ("moved", b.str());
+  EXPECT_EQ("fresh", a.str());
+}
+
+TEST_F(BuilderTest, testClear) {
+  string_builder b;
+  b.append("something");
+  b.clear();
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ("", b.str());
+  EXPECT_EQ("else", b.append("else").str());
+}
+
+TEST_F(BuilderTest, testWriteTo) {
+  const std::string shared = "shared piece;";
+  string_builder b;
+  std::string expected;
+  for (int i = 0; i < 3000; i++) {
+    b.appendRef(shared).appendFormat("%d;", i);
+    expected += shared + std::to_string(i) + ";";
+  }
+  std::FILE *file = std::tmpfile();
+  ASSERT_NE(nullptr, file);
+  EXPECT_EQ(expected.size(), b.writeTo(fileno(file)));
+  EXPECT_EQ(expected, readAll(file));
+  std::fclose(file);
+}
+
+TEST_F(BuilderTest, testWriteToBadDescriptor) {
+  string_builder b;
+  b.append("data");
+  EXPECT_THROW(b.writeTo(-1), std::system_error);
+}
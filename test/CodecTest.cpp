@@ -0,0 +1,163 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include "util/string/codec.hpp"
+
+using util::string::Base64;
+using util::string::base64DecodedSize;
+using util::string::base64EncodedSize;
+using util::string::decodeBase64;
+using util::string::decodeHex;
+using util::string::encodeBase64;
+using util::string::encodeHex;
+
+
+class CodecTest : public ::testing::Test {
+ protected:
+  std::string bytes(std::size_t length) {
+    std::string s;
+    for (std::size_t i = 0; i < length; i++) {
+      s.push_back(static_cast<char>(i * 37 + 11));
+    }
+    return s;
+  }
+};
+
+TEST_F(CodecTest, testEncodeHex) {
+  EXPECT_EQ("", encodeHex(""));
+  EXPECT_EQ("666f6f", encodeHex("foo"));
+  EXPECT_EQ("00ff7f80", encodeHex(std::string("\x00\xff\x7f\x80", 4)));
+  EXPECT_EQ("000102030405060708090a0b0c0d0e0f10",
+            encodeHex(std::string("\x00\x01\x02\x03\x04\x05\x06\x07\x08\x09"
+                                  "\x0a\x0b\x0c\x0d\x0e\x0f\x10", 17)));
+}
+
+TEST_F(CodecTest, testEncodeHexAppends) {
+  std::string out = "0x";
+  encodeHex("\x12\x34", out);
+  EXPECT_EQ("0x1234", out);
+}
+
+TEST_F(CodecTest, testDecodeHex) {
+  EXPECT_EQ("foo", decodeHex("666f6f"));
+  EXPECT_EQ("\xab\xcd\xef", decodeHex("ABcdEf"));
+  EXPECT_EQ(bytes(40), decodeHex(encodeHex(bytes(40))));
+}
+
+TEST_F(CodecTest, testDecodeHexRejectsInvalidInput) {
+  EXPECT_THROW(decodeHex("abc"), std::invalid_argument);
+  EXPECT_THROW(decodeHex("0g"), std::invalid_argument);
+  std::string hex = encodeHex(bytes(20));
+  hex[23] = 'x';
+  try {
+    decodeHex(hex);
+    FAIL();
+  } catch (const std::invalid_argument &e) {
+    EXPECT_STREQ("invalid hex character at offset 23", e.what());
+  }
+  std::string out = "keep";
+  EXPECT_THROW(decodeHex(hex, out), std::invalid_argument);
+  EXPECT_EQ("keep", out);
+}
+
+TEST_F(CodecTest, testHexRoundTrip) {
+  for (std::size_t length = 0; length < 70; length++) {
+    EXPECT_EQ(bytes(length), decodeHex(encodeHex(bytes(length))));
+  }
+}
+
+TEST_F(CodecTest, testEncodeBase64) {
+  // RFC 4648 test vectors
+  EXPECT_EQ("", encodeBase64(""));
+  EXPECT_EQ("Zg==", encodeBase64("f"));
+  EXPECT_EQ("Zm8=", encodeBase64("fo"));
+  EXPECT_EQ("Zm9v", encodeBase64("foo"));
+  EXPECT_EQ("Zm9vYg==", encodeBase64("foob"));
+  EXPECT_EQ("Zm9vYmE=", encodeBase64("fooba"));
+  EXPECT_EQ("Zm9vYmFy", encodeBase64("foobar"));
+  EXPECT_EQ("+/+/", encodeBase64("\xfb\xff\xbf"));
+}
+
+TEST_F(CodecTest, testEncodeBase64UrlSafe) {
+  EXPECT_EQ("Zg", encodeBase64("f", Base64::UrlSafe));
+  EXPECT_EQ("Zm8", encodeBase64("fo", Base64::UrlSafe));
+  EXPECT_EQ("Zm9vYmFy", encodeBase64("foobar", Base64::UrlSafe));
+  EXPECT_EQ("-_-_", encodeBase64("\xfb\xff\xbf", Base64::UrlSafe));
+}
+
+TEST_F(CodecTest, testSizes) {
+  for (std::size_t length = 0; length < 10; length++) {
+    EXPECT_EQ(encodeBase64(bytes(length)).size(), base64EncodedSize(length));
+    EXPECT_EQ(encodeBase64(bytes(length), Base64::UrlSafe).size(),
+              base64EncodedSize(length, Base64::UrlSafe));
+    EXPECT_EQ(length, base64DecodedSize(encodeBase64(bytes(length))));
+    EXPECT_EQ(length, base64DecodedSize(
+        encodeBase64(bytes(length), Base64::UrlSafe)));
+  }
+}
+
+TEST_F(CodecTest, testDecodeBase64) {
+  EXPECT_EQ("f", decodeBase64("Zg=="));
+  EXPECT_EQ("fo", decodeBase64("Zm8="));
+  EXPECT_EQ("foobar", decodeBase64("Zm9vYmFy"));
+  EXPECT_EQ("\xfb\xff\xbf", decodeBase64("+/+/"));
+  EXPECT_EQ("\xfb\xff\xbf", decodeBase64("-_-_", Base64::UrlSafe));
+  EXPECT_EQ("fo", decodeBase64("Zm8", Base64::UrlSafe));
+  EXPECT_EQ("fo", decodeBase64("Zm8=", Base64::UrlSafe));
+}
+
+TEST_F(CodecTest, testDecodeBase64RejectsInvalidInput) {
+  EXPECT_THROW(decodeBase64("Zm8"), std::invalid_argument);
+  EXPECT_THROW(decodeBase64("Z==="), std::invalid_argument);
+  EXPECT_THROW(decodeBase64("Zm=v"), std::invalid_argument);
+  EXPECT_THROW(decodeBase64("Zh=="), std::invalid_argument);
+  EXPECT_THROW(decodeBase64("Zm9="), std::invalid_argument);
+  EXPECT_THROW(decodeBase64("-_-_"), std::invalid_argument);
+  EXPECT_THROW(decodeBase64("+/+/", Base64::UrlSafe), std::invalid_argument);
+  EXPECT_THROW(decodeBase64("Zm9vY", Base64::UrlSafe), std::invalid_argument);
+  try {
+    decodeBase64("Zm9vYm Fy");
+    FAIL();
+  } catch (const std::invalid_argument &e) {
+    EXPECT_STREQ("base64 input is not padded", e.what());
+  }
+  try {
+    decodeBase64("Zm9vYm.y");
+    FAIL();
+  } catch (const std::invalid_argument &e) {
+    EXPECT_STREQ("invalid base64 character at offset 6", e.what());
+  }
+}
+
+TEST_F(CodecTest, testBase64RoundTrip) {
+  for (std::size_t length = 0; length < 70; length++) {
+    EXPECT_EQ(bytes(length), decodeBase64(encodeBase64(bytes(length))));
+    EXPECT_EQ(bytes(length),
+              decodeBase64(encodeBase64(bytes(length), Base64::UrlSafe),
+                           Base64::UrlSafe));
+  }
+}
@@ -0,0 +1,126 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "util/string/csv.hpp"
+
+typedef std::vector<std::vector<std::string>> Records;
+
+
+class CsvTest : public ::testing::Test {
+ protected:
+  Records parse(const std::string &text,
+                const util::string::csv_format &format =
+                    util::string::csv_format()) {
+    Records records;
+    util::string::csv_reader reader(text, format);
+    std::vector<util::string::string_view> fields;
+    while (reader.next(fields)) {
+      std::vector<std::string> record;
+      for (const auto &field : fields) {
+        record.push_back(field.str());
+      }
+      records.push_back(record);
+    }
+    return records;
+  }
+};
+
+TEST_F(CsvTest, testPlainFields) {
+  EXPECT_EQ(Records(), parse(""));
+  EXPECT_EQ(Records({{"a", "b", "c"}}), parse("a,b,c"));
+  EXPECT_EQ(Records({{"a", "b"}, {"c", "d"}}), parse("a,b\nc,d\n"));
+  EXPECT_EQ(Records({{"a", "b"}, {"c", "d"}}), parse("a,b\r\nc,d\r\n"));
+  EXPECT_EQ(Records({{"", "", ""}}), parse(",,"));
+  EXPECT_EQ(Records({{"a", ""}, {""}, {"b"}}), parse("a,\n\nb"));
+  EXPECT_EQ(Records({{"a\"b", "c"}}), parse("a\"b,c"));
+}
+
+TEST_F(CsvTest, testQuotedFields) {
+  EXPECT_EQ(Records({{"a,b", "c"}}), parse("\"a,b\",c"));
+  EXPECT_EQ(Records({{"line\nbreak", "x"}}), parse("\"line\nbreak\",x\n"));
+  EXPECT_EQ(Records({{"say \"hi\"", ""}}), parse("\"say \"\"hi\"\"\",\"\""));
+  EXPECT_EQ(Records({{"a"}, {"b"}}), parse("\"a\"\r\n\"b\"\r\n"));
+  EXPECT_EQ(Records({{"\""}}), parse("\"\"\"\""));
+}
+
+TEST_F(CsvTest, testUnescapedFieldsAreViewsIntoTheInput) {
+  const std::string TEXT = "plain,\"quoted\",\"esc\"\"aped\"";
+  util::string::csv_reader reader(TEXT);
+  std::vector<util::string::string_view> fields;
+  ASSERT_TRUE(reader.next(fields));
+  ASSERT_EQ(3, fields.size());
+  EXPECT_EQ(TEXT.data(), fields[0].data());
+  EXPECT_EQ(TEXT.data() + 7, fields[1].data());
+  EXPECT_EQ("esc\"aped", fields[2]);
+  EXPECT_FALSE(fields[2].data() >= TEXT.data() &&
+               fields[2].data() < TEXT.data() + TEXT.size());
+  EXPECT_FALSE(reader.next(fields));
+}
+
+TEST_F(CsvTest, testCustomFormat) {
+  const util::string::csv_format TSV('\t', '\'', '\\');
+  EXPECT_EQ(Records({{"a,b", "c\td", "e'f"}}),
+            parse("a,b\tc\\\td\t'e\\'f'", TSV));
+  EXPECT_EQ(Records({{"x\\y"}}), parse("x\\\\y", TSV));
+  const util::string::csv_format SEMICOLON(';');
+  EXPECT_EQ(Records({{"a", "b,c"}}), parse("a;b,c", SEMICOLON));
+}
+
+TEST_F(CsvTest, testLongRecords) {
+  std::string text;
+  Records expected;
+  for (int row = 0; row < 50; row++) {
+    std::vector<std::string> record;
+    for (int column = 0; column < 20; column++) {
+      std::string field(static_cast<std::size_t>(row + column), 'x');
+      record.push_back(field);
+      text += (column == 0 ? "" : ",") + field;
+    }
+    expected.push_back(record);
+    text += "\n";
+  }
+  EXPECT_EQ(expected, parse(text));
+}
+
+TEST_F(CsvTest, testMalformedInput) {
+  EXPECT_THROW(parse("\"never closed,a"), std::invalid_argument);
+  EXPECT_THROW(parse("\"a\"b,c"), std::invalid_argument);
+  EXPECT_THROW(parse("a\\", util::string::csv_format(',', '"', '\\')),
+               std::invalid_argument);
+}
+
+TEST_F(CsvTest, testWideReader) {
+  const std::wstring TEXT = L"a,\"b,c\"\n";
+  util::string::wcsv_reader reader(TEXT);
+  std::vector<util::string::wstring_view> fields;
+  ASSERT_TRUE(reader.next(fields));
+  ASSERT_EQ(2, fields.size());
+  EXPECT_EQ(L"a", fields[0]);
+  EXPECT_EQ(L"b,c", fields[1]);
+  EXPECT_FALSE(reader.next(fields));
+}
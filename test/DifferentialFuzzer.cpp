@@ -0,0 +1,255 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+// Differential fuzz target: the fast paths of split, lines, replace, trim
+// and translate, and their batch and pipeline stages, are checked against
+// the simple reference implementations below. Built with libFuzzer under
+// Clang; FuzzReplayMain.cpp drives it elsewhere.
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "util/string.hpp"
+#include "util/string/batch.hpp"
+#include "util/string/lines.hpp"
+#include "util/string/pipeline.hpp"
+
+namespace {
+
+typedef std::vector<std::string> tokens;
+
+// The tokens std::getline gives: every delimiter ends one, and the text
+// after the last delimiter is one unless it is empty
+tokens referenceSplit(const std::string &s, const char delim) {
+  tokens result;
+  std::string token;
+  bool pending = false;
+  for (const char ch : s) {
+    if (ch == delim) {
+      result.push_back(token);
+      token.clear();
+      pending = false;
+    } else {
+      token.push_back(ch);
+      pending = true;
+    }
+  }
+  if (pending) {
+    result.push_back(token);
+  }
+  return result;
+}
+
+// Leftmost, non-overlapping matches; an empty from leaves s as it is
+std::string referenceReplace(const std::string &s, const std::string &from,
+                             const std::string &to) {
+  if (from.empty()) {
+    return s;
+  }
+  std::string result;
+  std::size_t i = 0;
+  while (i < s.size()) {
+    if (s.compare(i, from.size(), from) == 0) {
+      result += to;
+      i += from.size();
+    } else {
+      result.push_back(s[i++]);
+    }
+  }
+  return result;
+}
+
+bool isCSpace(const char ch) {
+  return std::isspace(static_cast<unsigned char>(ch)) != 0;
+}
+
+template <typename Predicate>
+std::string referenceTrim(const std::string &s, Predicate pred,
+                          bool left, bool right) {
+  std::size_t first = 0;
+  std::size_t last = s.size();
+  while (left && first < last && pred(s[first])) {
+    first++;
+  }
+  while (right && last > first && pred(s[last - 1])) {
+    last--;
+  }
+  return s.substr(first, last - first);
+}
+
+// Characters past the shorter of from and to are left alone; the first
+// occurrence in from wins
+std::string referenceTranslate(const std::string &s, const std::string &from,
+                               const std::string &to) {
+  std::string result;
+  for (const char ch : s) {
+    char mapped = ch;
+    for (std::size_t i = 0; i < from.size() && i < to.size(); i++) {
+      if (ch == from[i]) {
+        mapped = to[i];
+        break;
+      }
+    }
+    result.push_back(mapped);
+  }
+  return result;
+}
+
+template <typename T>
+void check(const T &expected, const T &actual, const char *what) {
+  if (expected != actual) {
+    std::fprintf(stderr, "differential mismatch in %s\n", what);
+    std::abort();
+  }
+}
+
+void checkSplit(const std::string &s, const char delim) {
+  check(referenceSplit(s, delim), util::string::split(s, delim), "split");
+
+  tokens lines;
+  for (const auto line : util::string::lines(s)) {
+    lines.push_back(line.str());
+  }
+  check(referenceSplit(s, '\n'), lines, "lines");
+}
+
+void checkReplace(const std::string &s, const std::string &from,
+                  const std::string &to) {
+  const std::string expected = referenceReplace(s, from, to);
+  check(expected, util::string::replace(s, from, to), "replace");
+  check(expected,
+        util::string::pipe(util::string::stage::replace_stage<char>(from, to))(
+            util::string::string_view(s)),
+        "stage::replace");
+}
+
+void checkTrim(const std::string &s, const std::string &chars) {
+  check(referenceTrim(s, isCSpace, true, true), util::string::trim(s),
+        "trim");
+  check(referenceTrim(s, isCSpace, true, false), util::string::ltrim(s),
+        "ltrim");
+  check(referenceTrim(s, isCSpace, false, true), util::string::rtrim(s),
+        "rtrim");
+
+  auto inSet = [&](const char ch) {
+    return chars.find(ch) != std::string::npos;
+  };
+  const util::string::char_set set(chars);
+  const std::string expected = referenceTrim(s, inSet, true, true);
+  check(expected, util::string::trim(s, set), "trim(chars)");
+  check(referenceTrim(s, inSet, true, false), util::string::ltrim(s, set),
+        "ltrim(chars)");
+  check(referenceTrim(s, inSet, false, true), util::string::rtrim(s, set),
+        "rtrim(chars)");
+  check(expected,
+        util::string::trim(util::string::string_view(s), set).str(),
+        "trim(view, chars)");
+  check(expected,
+        util::string::pipe(util::string::stage::trim_stage<char>(set))(
+            util::string::string_view(s)),
+        "stage::trim");
+}
+
+void checkTranslate(const std::string &s, const std::string &from,
+                    const std::string &to) {
+  const std::string expected = referenceTranslate(s, from, to);
+  check(expected, util::string::translate(s, from, to), "translate");
+  check(expected,
+        util::string::pipe(
+            util::string::stage::translate_stage<char>(from, to))(
+            util::string::string_view(s)),
+        "stage::translate");
+}
+
+// The stages chained, over the whole text and over its tokens as a batch
+void checkChain(const std::string &s, const char delim,
+                const std::string &from, const std::string &to,
+                const std::string &chars) {
+  auto inSet = [&](const char ch) {
+    return chars.find(ch) != std::string::npos;
+  };
+  auto reference = [&](const std::string &input) {
+    return referenceTrim(referenceTranslate(
+        referenceReplace(input, from, to), from, to), inSet, true, true);
+  };
+  const util::string::char_set set(chars);
+
+  auto pipeline = util::string::stage::replace_stage<char>(from, to) |
+                  util::string::stage::translate_stage<char>(from, to) |
+                  util::string::stage::trim_stage<char>(set);
+  check(reference(s), pipeline(util::string::string_view(s)), "pipeline");
+
+  const tokens inputs = referenceSplit(s, delim);
+  util::string::arena arena;
+  util::string::batch::apply(inputs, arena,
+                             util::string::batch::replace_op<char>{from, to},
+                             util::string::batch::translate_op<char>{from, to},
+                             util::string::batch::trim_op<char>{set});
+  tokens batch;
+  for (std::size_t i = 0; i < arena.size(); i++) {
+    batch.push_back(arena[i].str());
+  }
+  tokens expected;
+  for (const auto &input : inputs) {
+    expected.push_back(reference(input));
+  }
+  check(expected, batch, "batch");
+}
+
+}  // namespace
+
+// Input layout: the split delimiter, then a byte holding the lengths of
+// from (low nibble) and to (high nibble), then one holding the length of
+// the trim set; those fields follow in that order and the rest is the text.
+// Lengths are clamped to what is left, so every input is valid.
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  if (size < 3) {
+    return 0;
+  }
+  const char *rest = reinterpret_cast<const char *>(data) + 3;
+  std::size_t left = size - 3;
+  auto take = [&](std::size_t length) {
+    length = std::min(length, left);
+    std::string field(rest, length);
+    rest += length;
+    left -= length;
+    return field;
+  };
+  const char delim = static_cast<char>(data[0]);
+  const std::string from = take(data[1] & 0x0f);
+  const std::string to = take(data[1] >> 4);
+  const std::string chars = take(data[2] & 0x0f);
+  const std::string s = take(left);
+
+  checkSplit(s, delim);
+  checkReplace(s, from, to);
+  checkTrim(s, chars);
+  checkTranslate(s, from, to);
+  checkChain(s, delim, from, to, chars);
+  return 0;
+}
@@ -0,0 +1,203 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include "util/string/distance.hpp"
+
+using util::string::damerauLevenshtein;
+using util::string::distance_query;
+using util::string::jaroWinkler;
+using util::string::levenshtein;
+
+
+class DistanceTest : public ::testing::Test {
+ protected:
+  std::string random(std::size_t length) {
+    std::uniform_int_distribution<int> letter(0, 3);
+    std::string s;
+    for (std::size_t i = 0; i < length; i++) {
+      s.push_back(static_cast<char>('a' + letter(engine_)));
+    }
+    return s;
+  }
+
+  std::size_t randomLength() {
+    return std::uniform_int_distribution<std::size_t>(0, 150)(engine_);
+  }
+
+  // The textbook dynamic programme, with transpositions optional
+  static std::size_t reference(const std::string &a, const std::string &b,
+                               bool transpositions) {
+    std::vector<std::vector<std::size_t>> d(
+        a.size() + 1, std::vector<std::size_t>(b.size() + 1));
+    for (std::size_t i = 0; i <= a.size(); i++) {
+      for (std::size_t j = 0; j <= b.size(); j++) {
+        if (i == 0 || j == 0) {
+          d[i][j] = i + j;
+          continue;
+        }
+        d[i][j] = std::min({d[i - 1][j] + 1, d[i][j - 1] + 1,
+                            d[i - 1][j - 1] + (a[i - 1] != b[j - 1])});
+        if (transpositions && i > 1 && j > 1 && a[i - 1] == b[j - 2] &&
+            a[i - 2] == b[j - 1]) {
+          d[i][j] = std::min(d[i][j], d[i - 2][j - 2] + 1);
+        }
+      }
+    }
+    return d[a.size()][b.size()];
+  }
+
+  static double referenceJaro(const std::string &a, const std::string &b) {
+    if (a.empty() || b.empty()) {
+      return a.empty() && b.empty() ? 1.0 : 0.0;
+    }
+    const std::size_t longer = std::max(a.size(), b.size());
+    const std::size_t window = longer / 2 > 0 ? longer / 2 - 1 : 0;
+    std::vector<bool> aMatched(a.size()), bMatched(b.size());
+    std::size_t matches = 0;
+    for (std::size_t j = 0; j < b.size(); j++) {
+      std::size_t low = j > window ? j - window : 0;
+      std::size_t high = std::min(j + window + 1, a.size());
+      for (std::size_t i = low; i < high; i++) {
+        if (!aMatched[i] && a[i] == b[j]) {
+          aMatched[i] = bMatched[j] = true;
+          matches++;
+          break;
+        }
+      }
+    }
+    if (matches == 0) {
+      return 0.0;
+    }
+    std::size_t mismatched = 0;
+    for (std::size_t i = 0, j = 0; i < a.size(); i++) {
+      if (aMatched[i]) {
+        while (!bMatched[j]) {
+          j++;
+        }
+        mismatched += a[i] != b[j++];
+      }
+    }
+    const double m = static_cast<double>(matches);
+    return (m / a.size() + m / b.size() + (m - mismatched / 2) / m) / 3.0;
+  }
+
+  std::mt19937 engine_{42};
+};
+
+TEST_F(DistanceTest, testLevenshtein) {
+  EXPECT_EQ(0u, levenshtein("", ""));
+  EXPECT_EQ(3u, levenshtein("", "abc"));
+  EXPECT_EQ(3u, levenshtein("kitten", "sitting"));
+  EXPECT_EQ(3u, levenshtein("sitting", "kitten"));
+  EXPECT_EQ(2u, levenshtein("ca", "ac"));
+  EXPECT_EQ(0u, levenshtein("same", "same"));
+}
+
+TEST_F(DistanceTest, testDamerauLevenshtein) {
+  EXPECT_EQ(1u, damerauLevenshtein("ca", "ac"));
+  EXPECT_EQ(1u, damerauLevenshtein("recieve", "receive"));
+  EXPECT_EQ(3u, damerauLevenshtein("ca", "abc"));
+  EXPECT_EQ(3u, damerauLevenshtein("kitten", "sitting"));
+}
+
+TEST_F(DistanceTest, testMatchesReference) {
+  for (int round = 0; round < 300; round++) {
+    const std::string a = random(randomLength());
+    const std::string b = random(randomLength());
+    EXPECT_EQ(reference(a, b, false), levenshtein(a, b)) << a << " " << b;
+    EXPECT_EQ(reference(a, b, true), damerauLevenshtein(a, b))
+        << a << " " << b;
+    distance_query query(a);
+    EXPECT_EQ(reference(a, b, false), query.levenshtein(b)) << a << " " << b;
+    EXPECT_EQ(reference(a, b, true), query.damerauLevenshtein(b))
+        << a << " " << b;
+  }
+}
+
+TEST_F(DistanceTest, testMaxDistance) {
+  EXPECT_EQ(2u, levenshtein("kitten", "sitting", 1));
+  EXPECT_EQ(3u, levenshtein("kitten", "sitting", 3));
+  EXPECT_EQ(1u, levenshtein("a", "abcdef", 0));
+  EXPECT_EQ(3u, distance_query("abcdef").levenshtein("a", 2));
+  for (int round = 0; round < 300; round++) {
+    const std::string a = random(randomLength());
+    const std::string b = random(randomLength());
+    const std::size_t limit = randomLength() / 2;
+    const std::size_t expected = std::min(reference(a, b, false), limit + 1);
+    EXPECT_EQ(expected, levenshtein(a, b, limit));
+    EXPECT_EQ(expected, distance_query(a).levenshtein(b, limit));
+    EXPECT_EQ(std::min(reference(a, b, true), limit + 1),
+              damerauLevenshtein(a, b, limit));
+  }
+}
+
+TEST_F(DistanceTest, testJaroWinkler) {
+  EXPECT_DOUBLE_EQ(1.0, jaroWinkler("", ""));
+  EXPECT_DOUBLE_EQ(0.0, jaroWinkler("abc", ""));
+  EXPECT_DOUBLE_EQ(1.0, jaroWinkler("same", "same"));
+  EXPECT_DOUBLE_EQ(0.0, jaroWinkler("abc", "xyz"));
+  EXPECT_NEAR(0.961, jaroWinkler("MARTHA", "MARHTA"), 0.001);
+  EXPECT_NEAR(0.840, jaroWinkler("DWAYNE", "DUANE"), 0.001);
+  EXPECT_NEAR(0.813, jaroWinkler("DIXON", "DICKSONX"), 0.001);
+  EXPECT_DOUBLE_EQ(jaroWinkler("MARTHA", "MARHTA"),
+                   distance_query("MARTHA").jaroWinkler("MARHTA"));
+}
+
+TEST_F(DistanceTest, testJaroMatchesReference) {
+  for (int round = 0; round < 300; round++) {
+    const std::string a = random(randomLength());
+    const std::string b = random(randomLength());
+    const double jaro = referenceJaro(a, b);
+    const double expected = jaro > 0.7 ? jaro +
+        std::min<std::size_t>(
+            4, std::mismatch(a.begin(), a.begin() + std::min(a.size(),
+                                                              b.size()),
+                             b.begin()).first - a.begin()) *
+            0.1 * (1.0 - jaro) : jaro;
+    EXPECT_NEAR(expected, jaroWinkler(a, b), 1e-12) << a << " " << b;
+  }
+}
+
+TEST_F(DistanceTest, testMinSimilarity) {
+  EXPECT_DOUBLE_EQ(0.0, jaroWinkler("MARTHA", "MARHTA", 0.97));
+  EXPECT_NEAR(0.961, jaroWinkler("MARTHA", "MARHTA", 0.9), 0.001);
+  EXPECT_DOUBLE_EQ(0.0, jaroWinkler("a", "abcdefghij", 0.8));
+}
+
+TEST_F(DistanceTest, testBatch) {
+  const std::vector<std::string> keys = {"apple", "apply", "maple", "ape"};
+  distance_query query("appel");
+  EXPECT_EQ((std::vector<std::size_t>{2, 2, 3, 2}),
+            levenshtein(query, keys));
+  EXPECT_EQ((std::vector<std::size_t>{1, 2, 2, 2}),
+            damerauLevenshtein(query, keys, 1));
+  std::vector<double> scores = jaroWinkler(query, keys);
+  ASSERT_EQ(4u, scores.size());
+  EXPECT_DOUBLE_EQ(jaroWinkler("appel", "maple"), scores[2]);
+}
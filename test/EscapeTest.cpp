@@ -0,0 +1,150 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include "util/string/escape.hpp"
+
+using util::string::escapeC;
+using util::string::escapeJson;
+using util::string::escapeUrl;
+using util::string::unescapeC;
+using util::string::unescapeJson;
+using util::string::unescapeUrl;
+
+
+class EscapeTest : public ::testing::Test {
+ protected:
+  // Long enough to take the vector path before and after the special byte
+  std::string pad(const std::string &s) {
+    return std::string(21, 'a') + s + std::string(19, 'b');
+  }
+};
+
+TEST_F(EscapeTest, testEscapeJson) {
+  EXPECT_EQ("", escapeJson(""));
+  EXPECT_EQ("plain text", escapeJson("plain text"));
+  EXPECT_EQ("say \\\"hi\\\"\\n", escapeJson("say \"hi\"\n"));
+  EXPECT_EQ("a\\\\b\\tc\\u0001\\u001F", escapeJson("a\\b\tc\x01\x1f"));
+  EXPECT_EQ("caf\xc3\xa9/", escapeJson("caf\xc3\xa9/"));
+  EXPECT_EQ(pad("\\r"), escapeJson(pad("\r")));
+  EXPECT_EQ(pad("\\u0000"), escapeJson(pad(std::string(1, '\0'))));
+}
+
+TEST_F(EscapeTest, testEscapeJsonAppends) {
+  std::string out = "{\"k\":\"";
+  escapeJson("v\"", out);
+  out += "\"}";
+  EXPECT_EQ("{\"k\":\"v\\\"\"}", out);
+}
+
+TEST_F(EscapeTest, testUnescapeJson) {
+  EXPECT_EQ("say \"hi\"\n", unescapeJson("say \\\"hi\\\"\\n"));
+  EXPECT_EQ("a/b\\", unescapeJson("a\\/b\\\\"));
+  EXPECT_EQ("caf\xc3\xa9", unescapeJson("caf\\u00e9"));
+  EXPECT_EQ("\xe2\x82\xac", unescapeJson("\\u20AC"));
+  EXPECT_EQ("\xf0\x9f\x98\x80", unescapeJson("\\ud83d\\ude00"));
+  EXPECT_THROW(unescapeJson("\\"), std::invalid_argument);
+  EXPECT_THROW(unescapeJson("\\x"), std::invalid_argument);
+  EXPECT_THROW(unescapeJson("\\u12"), std::invalid_argument);
+  EXPECT_THROW(unescapeJson("\\u12g4"), std::invalid_argument);
+  EXPECT_THROW(unescapeJson("\\ud83d"), std::invalid_argument);
+  EXPECT_THROW(unescapeJson("\\ude00"), std::invalid_argument);
+}
+
+TEST_F(EscapeTest, testJsonRoundTrip) {
+  std::string all;
+  for (int ch = 0; ch < 256; ch++) {
+    all.push_back(static_cast<char>(ch));
+  }
+  EXPECT_EQ(all, unescapeJson(escapeJson(all)));
+}
+
+TEST_F(EscapeTest, testEscapeUrl) {
+  EXPECT_EQ("AZaz09-._~", escapeUrl("AZaz09-._~"));
+  EXPECT_EQ("a%20b%2Bc%2F%3F", escapeUrl("a b+c/?"));
+  EXPECT_EQ("caf%C3%A9", escapeUrl("caf\xc3\xa9"));
+  EXPECT_EQ(pad("%40"), escapeUrl(pad("@")));
+  EXPECT_EQ(pad("%60%7B"), escapeUrl(pad("`{")));
+}
+
+TEST_F(EscapeTest, testUnescapeUrl) {
+  EXPECT_EQ("a b+c/?", unescapeUrl("a%20b+c%2f%3F"));
+  EXPECT_EQ("caf\xc3\xa9", unescapeUrl("caf%C3%A9"));
+  EXPECT_THROW(unescapeUrl("%"), std::invalid_argument);
+  EXPECT_THROW(unescapeUrl("%2"), std::invalid_argument);
+  EXPECT_THROW(unescapeUrl("%zz"), std::invalid_argument);
+}
+
+TEST_F(EscapeTest, testUrlRoundTrip) {
+  std::string all;
+  for (int ch = 0; ch < 256; ch++) {
+    all.push_back(static_cast<char>(ch));
+  }
+  EXPECT_EQ(all, unescapeUrl(escapeUrl(all)));
+}
+
+TEST_F(EscapeTest, testEscapeC) {
+  EXPECT_EQ("it\\'s \\\"ok\\\"\\n", escapeC("it's \"ok\"\n"));
+  EXPECT_EQ("\\a\\b\\f\\r\\t\\v\\\\", escapeC("\a\b\f\r\t\v\\"));
+  EXPECT_EQ("\\0331\\177", escapeC("\x1b" "1\x7f"));
+  EXPECT_EQ("caf\xc3\xa9", escapeC("caf\xc3\xa9"));
+  EXPECT_EQ(pad("\\000"), escapeC(pad(std::string(1, '\0'))));
+}
+
+TEST_F(EscapeTest, testUnescapeC) {
+  EXPECT_EQ("it's \"ok\"\n?", unescapeC("it\\'s \\\"ok\\\"\\n\\?"));
+  EXPECT_EQ(std::string("\0z", 2), unescapeC("\\0z"));
+  EXPECT_EQ("\x01", unescapeC("\\01"));
+  EXPECT_EQ("\x1b" "1", unescapeC("\\0331"));
+  EXPECT_EQ("\xff" "f", unescapeC("\\xfff"));
+  EXPECT_THROW(unescapeC("\\"), std::invalid_argument);
+  EXPECT_THROW(unescapeC("\\q"), std::invalid_argument);
+  EXPECT_THROW(unescapeC("\\xg"), std::invalid_argument);
+  EXPECT_THROW(unescapeC("\\777"), std::invalid_argument);
+}
+
+TEST_F(EscapeTest, testCRoundTrip) {
+  std::string all;
+  for (int ch = 0; ch < 256; ch++) {
+    all.push_back(static_cast<char>(ch));
+  }
+  EXPECT_EQ(all, unescapeC(escapeC(all)));
+}
+
+TEST_F(EscapeTest, testRejectedInputLeavesBufferUnchanged) {
+  // Each input decodes a while before the error
+  std::string out = "keep";
+  EXPECT_THROW(unescapeJson(pad("\\n\\ud800x"), out), std::invalid_argument);
+  EXPECT_EQ("keep", out);
+  EXPECT_THROW(unescapeJson(pad("\\u12zz"), out), std::invalid_argument);
+  EXPECT_EQ("keep", out);
+  EXPECT_THROW(unescapeUrl(pad("%41%zz"), out), std::invalid_argument);
+  EXPECT_EQ("keep", out);
+  EXPECT_THROW(unescapeC(pad("\\t\\777"), out), std::invalid_argument);
+  EXPECT_EQ("keep", out);
+  unescapeC(pad("\\t"), out);
+  EXPECT_EQ("keep" + pad("\t"), out);
+}
@@ -0,0 +1,108 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+// Stands in for libFuzzer where it is not available: runs the fuzz target
+// over the files and directories given on the command line, then over
+// -runs=N random inputs (none by default). Other flags are ignored, so the
+// same command line works with both drivers.
+
+#include <dirent.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+namespace {
+
+void runInput(const std::string &input) {
+  LLVMFuzzerTestOneInput(reinterpret_cast<const uint8_t *>(input.data()),
+                         input.size());
+}
+
+// Returns the number of inputs run from path
+std::size_t runPath(const std::string &path) {
+  DIR *dir = opendir(path.c_str());
+  if (dir == nullptr) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+      std::fprintf(stderr, "cannot read %s\n", path.c_str());
+      std::exit(EXIT_FAILURE);
+    }
+    runInput(std::string(std::istreambuf_iterator<char>(file),
+                         std::istreambuf_iterator<char>()));
+    return 1;
+  }
+  std::size_t count = 0;
+  while (const dirent *entry = readdir(dir)) {
+    if (entry->d_name[0] != '.') {
+      count += runPath(path + "/" + entry->d_name);
+    }
+  }
+  closedir(dir);
+  return count;
+}
+
+// Random inputs drawn from a small alphabet, so that delimiters, matches
+// and trim set members actually occur
+std::string randomInput(std::mt19937 &random) {
+  static const char ALPHABET[] = " \t\n\rab,\0";
+  std::uniform_int_distribution<std::size_t> length(0, 80);
+  std::uniform_int_distribution<std::size_t> pick(0, sizeof(ALPHABET) - 2);
+  std::uniform_int_distribution<int> byte(0, 255);
+  std::string input;
+  input.push_back(ALPHABET[pick(random)]);
+  input.push_back(static_cast<char>(byte(random)));
+  input.push_back(static_cast<char>(byte(random)));
+  for (std::size_t i = length(random); i > 0; i--) {
+    input.push_back(ALPHABET[pick(random)]);
+  }
+  return input;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  std::size_t runs = 0;
+  std::size_t inputs = 0;
+  for (int i = 1; i < argc; i++) {
+    if (std::strncmp(argv[i], "-runs=", 6) == 0) {
+      runs = std::strtoul(argv[i] + 6, nullptr, 10);
+    } else if (argv[i][0] != '-') {
+      inputs += runPath(argv[i]);
+    }
+  }
+  std::mt19937 random(runs);
+  for (std::size_t i = 0; i < runs; i++) {
+    runInput(randomInput(random));
+  }
+  std::printf("ran %zu inputs and %zu random inputs\n", inputs, runs);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,146 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include "util/string/glob.hpp"
+
+
+class GlobTest : public ::testing::Test {
+};
+
+TEST_F(GlobTest, testLiteralPatterns) {
+  EXPECT_TRUE(util::string::match("", ""));
+  EXPECT_TRUE(util::string::match("hello", "hello"));
+  EXPECT_FALSE(util::string::match("hello", "hello!"));
+  EXPECT_FALSE(util::string::match("hello", "hell"));
+  EXPECT_FALSE(util::string::match("", "a"));
+}
+
+TEST_F(GlobTest, testStar) {
+  EXPECT_TRUE(util::string::match("*", ""));
+  EXPECT_TRUE(util::string::match("*", "anything"));
+  EXPECT_TRUE(util::string::match("*.log", "server.log"));
+  EXPECT_TRUE(util::string::match("*.log", ".log"));
+  EXPECT_FALSE(util::string::match("*.log", "server.log.1"));
+  EXPECT_TRUE(util::string::match("server*", "server.log"));
+  EXPECT_TRUE(util::string::match("a*b*c", "abc"));
+  EXPECT_TRUE(util::string::match("a*b*c", "axxbyybzzc"));
+  EXPECT_FALSE(util::string::match("a*b*c", "axxbyyzz"));
+  EXPECT_TRUE(util::string::match("*ab*ab*", "xabyab"));
+  EXPECT_FALSE(util::string::match("*ab*ab*", "xaby"));
+  EXPECT_FALSE(util::string::match("ab*ba", "aba"));
+  EXPECT_TRUE(util::string::match("**a**", "bab"));
+}
+
+TEST_F(GlobTest, testQuestionMark) {
+  EXPECT_TRUE(util::string::match("api/*/v?", "api/users/v2"));
+  EXPECT_FALSE(util::string::match("api/*/v?", "api/users/v10"));
+  EXPECT_TRUE(util::string::match("???", "abc"));
+  EXPECT_FALSE(util::string::match("???", "ab"));
+  EXPECT_TRUE(util::string::match("*?b", "ab"));
+}
+
+TEST_F(GlobTest, testCharacterClasses) {
+  EXPECT_TRUE(util::string::match("file[0-9].txt", "file7.txt"));
+  EXPECT_FALSE(util::string::match("file[0-9].txt", "fileA.txt"));
+  EXPECT_TRUE(util::string::match("[!a-c]*", "dog"));
+  EXPECT_FALSE(util::string::match("[^a-c]*", "cat"));
+  EXPECT_TRUE(util::string::match("[]x]", "]"));
+  EXPECT_TRUE(util::string::match("[a-]", "-"));
+  EXPECT_TRUE(util::string::match("*[xyz]", "abcz"));
+}
+
+TEST_F(GlobTest, testEscapes) {
+  EXPECT_TRUE(util::string::match("a\\*b", "a*b"));
+  EXPECT_FALSE(util::string::match("a\\*b", "axb"));
+  EXPECT_TRUE(util::string::match("\\?", "?"));
+  EXPECT_THROW(util::string::glob("abc\\"), std::invalid_argument);
+  EXPECT_THROW(util::string::glob("[abc"), std::invalid_argument);
+}
+
+TEST_F(GlobTest, testCaseInsensitive) {
+  const util::string::glob pattern("*.LOG", util::string::Case::Insensitive);
+  EXPECT_TRUE(pattern("server.log"));
+  EXPECT_TRUE(pattern("SERVER.Log"));
+  EXPECT_FALSE(pattern("server.txt"));
+  EXPECT_TRUE(util::string::match("[A-C]x", "bX",
+                                  util::string::Case::Insensitive));
+  EXPECT_FALSE(util::string::match("*.LOG", "server.log"));
+}
+
+TEST_F(GlobTest, testCompiledPatternReuse) {
+  const util::string::glob pattern("api/*/v?");
+  const std::string PATHS[] = {"api/a/v1", "api/b/v22", "api//v3", "app/a/v1"};
+  EXPECT_TRUE(pattern(PATHS[0]));
+  EXPECT_FALSE(pattern(PATHS[1]));
+  EXPECT_TRUE(pattern(PATHS[2]));
+  EXPECT_FALSE(pattern(PATHS[3]));
+}
+
+TEST_F(GlobTest, testWideStrings) {
+  EXPECT_TRUE(util::string::match(L"*.txt", L"notes.txt"));
+  EXPECT_TRUE(util::string::match(L"N?TES*", L"notes.txt",
+                                  util::string::Case::Insensitive));
+  EXPECT_FALSE(util::string::match(L"[!n]*", L"notes.txt"));
+}
+
+TEST_F(GlobTest, testInnerSegmentsWithWildcards) {
+  EXPECT_TRUE(util::string::match("*a?c*", "xxabcxx"));
+  EXPECT_TRUE(util::string::match("*[0-9][0-9]x*", "a1b23x"));
+  EXPECT_FALSE(util::string::match("*[0-9][0-9]x*", "a1b2x3x"));
+  EXPECT_TRUE(util::string::match("*a?a?b*", "aaaaaaab"));
+  EXPECT_TRUE(util::string::match("*\xe9?*", "caf\xe9!"));
+  EXPECT_TRUE(util::string::match("*LOG?*", "a.log1",
+                                  util::string::Case::Insensitive));
+  EXPECT_TRUE(util::string::match(L"*é?中*", L"café!中"));
+  EXPECT_FALSE(util::string::match(L"*中?é*", L"中é"));
+
+  // Longer than one shift-and word
+  const std::string SEGMENT = "*" + std::string(70, '?') + "z*";
+  EXPECT_TRUE(util::string::match(SEGMENT, std::string(100, 'a') + "z"));
+  EXPECT_FALSE(util::string::match(SEGMENT, std::string(60, 'a') + "z"));
+  std::string classes = "*";
+  for (int i = 0; i < 130; i++) {
+    classes += "[ab]";
+  }
+  classes += "c*";
+  EXPECT_TRUE(util::string::match(
+      classes, std::string(200, 'a') + std::string(130, 'b') + "c"));
+  EXPECT_FALSE(util::string::match(
+      classes, std::string(129, 'a') + "c" + std::string(129, 'b') + "c"));
+}
+
+TEST_F(GlobTest, testInnerLiteralSegments) {
+  // Partial matches that must fall back within the segment
+  EXPECT_TRUE(util::string::match("*aab*", "aaab"));
+  EXPECT_TRUE(util::string::match("x*abab*y", "xabaabababy"));
+  EXPECT_FALSE(util::string::match("x*abab*y", "xabaabby"));
+  EXPECT_TRUE(util::string::match("*a*b*", "ab"));
+  const std::string RUN(1000, 'a');
+  const std::string PATTERN = "*" + std::string(500, 'a') + "b*";
+  EXPECT_TRUE(util::string::match(PATTERN, RUN + "b" + RUN));
+  EXPECT_FALSE(util::string::match(PATTERN, RUN + RUN));
+}
@@ -0,0 +1,119 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include "AllocationCounter.hpp"
+#include "util/string.hpp"
+#include "util/string/hash.hpp"
+
+
+class HashTest : public ::testing::Test {
+ protected:
+  // Covers the empty, 1-3, 4-16, 17-48 and longer code paths
+  const std::size_t LENGTHS[10] = {0, 1, 3, 4, 8, 16, 17, 48, 49, 200};
+};
+
+TEST_F(HashTest, testStringAndViewAgree) {
+  const std::string TEXT(200, 'x');
+  for (std::size_t length : LENGTHS) {
+    const std::string s = TEXT.substr(0, length);
+    util::string::string_view view(TEXT.data(), length);
+    EXPECT_EQ(util::string::hash(s), util::string::hash(view));
+    EXPECT_EQ(util::string::hash(s.c_str()), util::string::hash(view));
+  }
+}
+
+TEST_F(HashTest, testHashSpreadsValues) {
+  std::set<std::uint64_t> seen;
+  std::string s;
+  for (int i = 0; i < 1000; i++) {
+    seen.insert(util::string::hash(std::to_string(i)));
+    s.push_back(static_cast<char>('a' + i % 26));
+    seen.insert(util::string::hash(s));
+  }
+  EXPECT_EQ(2000, seen.size());
+  EXPECT_NE(util::string::hash("abc"), util::string::hash("abc", 1));
+}
+
+TEST_F(HashTest, testHashIgnoreCase) {
+  const std::string TEXT =
+      "The Quick Brown Fox Jumps Over The Lazy Dog @[`{ \xC3\x89t\xC3\xA9 "
+      "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG";
+  for (std::size_t length : LENGTHS) {
+    const std::string s = TEXT.substr(0, length);
+    EXPECT_EQ(util::string::hash(util::string::lowercase(s)),
+              util::string::hashIgnoreCase(s));
+    EXPECT_EQ(util::string::hashIgnoreCase(util::string::uppercase(s)),
+              util::string::hashIgnoreCase(s));
+  }
+  EXPECT_NE(util::string::hashIgnoreCase("@"),
+            util::string::hashIgnoreCase("`"));
+}
+
+TEST_F(HashTest, testHashForWString) {
+  EXPECT_EQ(util::string::hash(std::wstring(L"hello")),
+            util::string::hash(L"hello"));
+  EXPECT_NE(util::string::hash(L"hello"), util::string::hash(L"hellO"));
+}
+
+TEST_F(HashTest, testHashDoesNotAllocate) {
+  const std::string LONG(100, 'x');
+  EXPECT_ALLOCATIONS(0, util::string::hash(LONG));
+  EXPECT_ALLOCATIONS(0, util::string::hashIgnoreCase(LONG));
+  EXPECT_ALLOCATIONS(0, util::string::string_hash()(LONG));
+}
+
+TEST_F(HashTest, testFunctorsWithUnorderedContainers) {
+  std::unordered_map<std::string, int,
+                     util::string::string_hash,
+                     util::string::string_equal> counts;
+  for (const auto &token : util::string::split("a b a c a", ' ')) {
+    counts[token]++;
+  }
+  EXPECT_EQ(3, counts["a"]);
+  EXPECT_EQ(1, counts["c"]);
+
+  std::unordered_set<std::string, util::string::istring_hash,
+                     util::string::istring_equal> keys = {"Content-Type"};
+  EXPECT_EQ(1, keys.count("content-type"));
+  EXPECT_EQ(0, keys.count("content-length"));
+
+  std::unordered_set<util::string::string_view> views = {"x", "y"};
+  EXPECT_EQ(1, views.count("x"));
+}
+
+#if __cplusplus >= 202002L
+TEST_F(HashTest, testHeterogeneousLookup) {
+  std::unordered_map<std::string, int,
+                     util::string::string_hash,
+                     util::string::string_equal> map = {{"key", 1}};
+  const std::string TEXT = "  key  ";
+  EXPECT_ALLOCATIONS(0, map.find(util::string::trim(
+      util::string::string_view(TEXT), util::string::whitespace())));
+}
+#endif
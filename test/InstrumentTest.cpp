@@ -0,0 +1,100 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include "util/string.hpp"
+#include "util/string/instrument.hpp"
+
+using util::string::instrument::Api;
+
+
+class InstrumentTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    util::string::instrument::reset();
+  }
+};
+
+TEST_F(InstrumentTest, testRecordAndCollect) {
+  util::string::instrument::record(Api::Split, 100, 3, 0);
+  util::string::instrument::record(Api::Split, 20, 1, 1000);
+  auto snapshot = util::string::instrument::collect();
+  EXPECT_EQ(2, snapshot[Api::Split].calls);
+  EXPECT_EQ(120, snapshot[Api::Split].bytes);
+  EXPECT_EQ(4, snapshot[Api::Split].result_blocks);
+  EXPECT_EQ(1, snapshot[Api::Split].latency[0]);
+  EXPECT_EQ(1, snapshot[Api::Split].latency[9]);
+  EXPECT_EQ(0, snapshot[Api::Join].calls);
+}
+
+TEST_F(InstrumentTest, testCollectIncludesExitedThreads) {
+  std::thread worker([] {
+    util::string::instrument::record(Api::Format, 10, 1, 5);
+  });
+  worker.join();
+  util::string::instrument::record(Api::Format, 10, 1, 5);
+  EXPECT_EQ(2, util::string::instrument::collect()[Api::Format].calls);
+  util::string::instrument::reset();
+  EXPECT_EQ(0, util::string::instrument::collect()[Api::Format].calls);
+}
+
+TEST_F(InstrumentTest, testForEach) {
+  util::string::instrument::record(Api::Join, 1, 0, 0);
+  std::string names;
+  std::uint64_t calls = 0;
+  util::string::instrument::forEach(
+      util::string::instrument::collect(),
+      [&](const char *name, const util::string::instrument::counters &c) {
+        names += std::string(name) + " ";
+        calls += c.calls;
+      });
+  EXPECT_EQ("transform trim replace reverse translate format split join ",
+            names);
+  EXPECT_EQ(1, calls);
+}
+
+#ifdef UTIL_STRING_INSTRUMENTATION
+TEST_F(InstrumentTest, testStringFunctionsReportCalls) {
+  util::string::split(std::string("hello world"), ' ');
+  util::string::replace("hello", "l", "L");
+  util::string::uppercase("hello");
+  auto snapshot = util::string::instrument::collect();
+  EXPECT_EQ(1, snapshot[Api::Split].calls);
+  EXPECT_EQ(11, snapshot[Api::Split].bytes);
+  EXPECT_EQ(1, snapshot[Api::Split].result_blocks);
+  EXPECT_EQ(1, snapshot[Api::Replace].calls);
+  EXPECT_EQ(1, snapshot[Api::Transform].calls);
+}
+
+TEST_F(InstrumentTest, testFormatReportsOutputSize) {
+  util::string::format("%s-%d", "abc", 42);
+  util::string::format(L"%ls", std::wstring(1000, L'x'));
+  EXPECT_THROW(util::string::format(L"%s", "\xff"), std::invalid_argument);
+  auto snapshot = util::string::instrument::collect();
+  EXPECT_EQ(3, snapshot[Api::Format].calls);
+  EXPECT_EQ(6 + 1000 * sizeof(wchar_t), snapshot[Api::Format].bytes);
+}
+#endif
@@ -0,0 +1,125 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "AllocationCounter.hpp"
+#include "util/string.hpp"
+#include "util/string/lines.hpp"
+
+
+class LinesTest : public ::testing::Test {
+ protected:
+  template <typename T>
+  std::vector<std::basic_string<T>> collect(
+      const util::string::basic_line_range<T> &range) {
+    std::vector<std::basic_string<T>> out;
+    for (const auto &line : range) {
+      out.push_back(line.str());
+    }
+    return out;
+  }
+};
+
+TEST_F(LinesTest, testLinesMatchSplit) {
+  const std::vector<std::string> INPUTS = {
+    "", "\n", "a", "a\n", "a\nb", "a\n\nb\n", "\n\n", "hello\nworld\n!"};
+  for (const auto &input : INPUTS) {
+    EXPECT_EQ(util::string::split(input, '\n'),
+              collect(util::string::lines(input))) << input;
+  }
+}
+
+TEST_F(LinesTest, testStripCR) {
+  const std::string TEXT = "first\r\nsecond\n\r\nlast\r";
+  const std::vector<std::string> KEPT = {"first\r", "second", "\r", "last\r"};
+  const std::vector<std::string> STRIPPED = {"first", "second", "", "last"};
+  EXPECT_EQ(KEPT, collect(util::string::lines(TEXT)));
+  EXPECT_EQ(STRIPPED, collect(util::string::lines(
+      TEXT, util::string::LineEnding::StripCR)));
+}
+
+TEST_F(LinesTest, testLinesAreViewsIntoTheBuffer) {
+  const std::string TEXT = std::string(100, 'x') + "\n" + std::string(50, 'y');
+  AllocationCounter counter;
+  std::size_t total = 0;
+  for (auto line : util::string::lines(TEXT)) {
+    EXPECT_GE(line.data(), TEXT.data());
+    total += line.size();
+  }
+  EXPECT_EQ(0, counter.allocations());
+  EXPECT_EQ(150, total);
+}
+
+TEST_F(LinesTest, testLinesForWString) {
+  const std::vector<std::wstring> EXPECTED = {L"a", L"b"};
+  EXPECT_EQ(EXPECTED, collect(util::string::lines(
+      L"a\r\nb\r\n", util::string::LineEnding::StripCR)));
+}
+
+TEST_F(LinesTest, testBlocksEndAtNewlines) {
+  std::string text;
+  for (int i = 0; i < 100; i++) {
+    text += "line " + std::to_string(i) + "\n";
+  }
+  text += "no newline";
+  auto parts = util::string::blocks(util::string::string_view(text), 4);
+  EXPECT_LE(parts.size(), 4);
+  std::string joined;
+  for (std::size_t i = 0; i < parts.size(); i++) {
+    if (i + 1 < parts.size()) {
+      EXPECT_EQ('\n', parts[i].back());
+    }
+    joined += parts[i].str();
+  }
+  EXPECT_EQ(text, joined);
+  EXPECT_TRUE(util::string::blocks(util::string::string_view(), 4).empty());
+}
+
+TEST_F(LinesTest, testForEachBlock) {
+  std::string text;
+  for (int i = 0; i < 1000; i++) {
+    text += std::to_string(i) + "\r\n";
+  }
+  std::vector<std::size_t> counts(8, 0);
+  std::vector<long> sums(8, 0);
+  util::string::forEachBlock(
+      util::string::string_view(text), 8,
+      [&](std::size_t block, const util::string::line_range &range) {
+        for (const auto &line : range) {
+          counts[block]++;
+          sums[block] += std::stol(line.str());
+        }
+      },
+      util::string::LineEnding::StripCR);
+  std::size_t count = 0;
+  long sum = 0;
+  for (std::size_t i = 0; i < counts.size(); i++) {
+    count += counts[i];
+    sum += sums[i];
+  }
+  EXPECT_EQ(1000, count);
+  EXPECT_EQ(999 * 1000 / 2, sum);
+}
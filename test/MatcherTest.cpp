@@ -0,0 +1,119 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "util/string.hpp"
+#include "util/string/matcher.hpp"
+
+
+class MatcherTest : public ::testing::Test {
+ protected:
+  template <typename T, std::size_t N, typename Predicate>
+  void checkAgainst(const util::string::basic_matcher<T, N> &matcher,
+                    const std::vector<std::basic_string<T>> &needles,
+                    const std::vector<std::basic_string<T>> &inputs,
+                    Predicate pred) {
+    for (const auto &input : inputs) {
+      std::size_t expected = util::string::basic_matcher<T, N>::npos;
+      for (std::size_t i = 0; i < needles.size(); i++) {
+        if (pred(input, needles[i])) {
+          expected = i;
+          break;
+        }
+      }
+      EXPECT_EQ(expected, matcher.find(input));
+    }
+  }
+};
+
+TEST_F(MatcherTest, testPrefixMatcherForString) {
+  const auto matcher = util::string::prefixMatcher(
+      "/api/", "/static/", "/api/v2/", "/");
+  EXPECT_EQ(0, matcher("/api/users"));
+  EXPECT_EQ(0, matcher("/api/v2/users"));
+  EXPECT_EQ(1, matcher("/static/app.js"));
+  EXPECT_EQ(3, matcher("/index.html"));
+  EXPECT_EQ(decltype(matcher)::npos, matcher("index.html"));
+  EXPECT_EQ(decltype(matcher)::npos, matcher(""));
+}
+
+TEST_F(MatcherTest, testSuffixMatcherForString) {
+  const auto matcher = util::string::suffixMatcher(".tar.gz", ".gz", ".txt");
+  EXPECT_EQ(0, matcher("archive.tar.gz"));
+  EXPECT_EQ(1, matcher("archive.gz"));
+  EXPECT_EQ(2, matcher(std::string("notes.txt")));
+  EXPECT_EQ(decltype(matcher)::npos, matcher("notes.md"));
+}
+
+TEST_F(MatcherTest, testContainsMatcherForString) {
+  const auto matcher = util::string::containsMatcher("she", "he", "hers");
+  EXPECT_EQ(1, matcher("ahe"));
+  EXPECT_EQ(0, matcher("ushers"));
+  EXPECT_EQ(1, matcher("hhers"));
+  EXPECT_EQ(decltype(matcher)::npos, matcher("hrs"));
+}
+
+TEST_F(MatcherTest, testMatcherWithEmptyNeedle) {
+  EXPECT_EQ(1, util::string::prefixMatcher("abc", "")("xyz"));
+  EXPECT_EQ(1, util::string::suffixMatcher("abc", "")(""));
+  EXPECT_EQ(1, util::string::containsMatcher("abc", "")("ab"));
+}
+
+TEST_F(MatcherTest, testMatcherForWString) {
+  EXPECT_EQ(1, util::string::prefixMatcher(L"foo", L"bar")(L"barbaz"));
+  EXPECT_EQ(0, util::string::suffixMatcher(L"baz", L"bar")(L"barbaz"));
+  EXPECT_EQ(1, util::string::containsMatcher(L"qux", L"rb")(L"barbaz"));
+}
+
+TEST_F(MatcherTest, testMatcherAgreesWithPredicates) {
+  const std::vector<std::string> NEEDLES = {"ab", "abc", "b", "cab", "\xff"};
+  const std::vector<std::string> INPUTS = {
+    "", "a", "ab", "abc", "cab", "xcabx", "bbb", "zzz", "x\xff", "\xff\x01"};
+  std::array<std::string, 5> needles;
+  std::copy(NEEDLES.begin(), NEEDLES.end(), needles.begin());
+
+  checkAgainst(
+      util::string::basic_matcher<char, 5>(
+          util::string::MatchKind::Prefix, needles),
+      NEEDLES, INPUTS,
+      [](const std::string &s, const std::string &n) {
+        return util::string::startsWith(s, n);
+      });
+  checkAgainst(
+      util::string::basic_matcher<char, 5>(
+          util::string::MatchKind::Suffix, needles),
+      NEEDLES, INPUTS,
+      [](const std::string &s, const std::string &n) {
+        return util::string::endsWith(s, n);
+      });
+  checkAgainst(
+      util::string::basic_matcher<char, 5>(
+          util::string::MatchKind::Contains, needles),
+      NEEDLES, INPUTS,
+      [](const std::string &s, const std::string &n) {
+        return util::string::contains(s, n);
+      });
+}
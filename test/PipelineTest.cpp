@@ -0,0 +1,94 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <cctype>
+#include <string>
+#include <vector>
+#include "util/string.hpp"
+#include "util/string/pipeline.hpp"
+
+namespace stage = util::string::stage;
+
+
+class PipelineTest : public ::testing::Test {
+};
+
+TEST_F(PipelineTest, testSingleStage) {
+  EXPECT_EQ("HELLO", util::string::pipe(stage::uppercase())("hello"));
+  EXPECT_EQ("hello", util::string::pipe(stage::trim())("  hello \t"));
+  EXPECT_EQ("olleh", util::string::pipe(stage::reverse())("hello"));
+  EXPECT_EQ("h1ll2", util::string::pipe(
+      stage::translate("eolz", "12"))("hello"));
+}
+
+TEST_F(PipelineTest, testChainMatchesNestedCalls) {
+  const std::vector<std::string> INPUTS = {
+    "", "   ", "  Banana Bandana  ", "aaaa", "ABA ABA", " a b a ",
+    std::string(300, 'A') + " " + std::string(300, 'a')};
+  auto pipeline = stage::replace("a", "b") | stage::lowercase() |
+      stage::trim();
+  for (const auto &input : INPUTS) {
+    EXPECT_EQ(util::string::trim(util::string::lowercase(
+        util::string::replace(input, "a", "b"))), pipeline(input));
+  }
+}
+
+TEST_F(PipelineTest, testReplaceWithOverlappingPrefixes) {
+  const std::vector<std::string> INPUTS = {
+    "aab", "aaab", "abaabab", "ababababa", "aaaaa", "xaaby", "aa"};
+  auto pipeline = util::string::pipe(stage::replace("aab", "<>"));
+  for (const auto &input : INPUTS) {
+    EXPECT_EQ(util::string::replace(input, "aab", "<>"), pipeline(input));
+  }
+  auto abab = util::string::pipe(stage::replace("abab", "X"));
+  for (const auto &input : INPUTS) {
+    EXPECT_EQ(util::string::replace(input, "abab", "X"), abab(input));
+  }
+}
+
+TEST_F(PipelineTest, testTrimKeepsInnerWhitespace) {
+  auto pipeline = stage::trim() | stage::replace(" ", "_") | stage::trim("_");
+  EXPECT_EQ("a__b", pipeline("  a  b  "));
+  EXPECT_EQ("", pipeline("   "));
+}
+
+TEST_F(PipelineTest, testAppendTo) {
+  auto pipeline = stage::trim() | stage::uppercase() | stage::reverse();
+  std::string out = "result: ";
+  pipeline.appendTo(" abc ", out);
+  EXPECT_EQ("result: CBA", out);
+}
+
+TEST_F(PipelineTest, testTransformStage) {
+  auto pipeline = stage::transform([](char ch) { return ch == '-' ? '+' : ch; })
+      | stage::replace("++", "=");
+  EXPECT_EQ("a=b+", pipeline(std::string("a--b-")));
+}
+
+TEST_F(PipelineTest, testPipelineForWString) {
+  auto pipeline = stage::trim(L" ") | stage::replace(L"ll", L"LL") |
+      stage::translate(L"o", L"0");
+  EXPECT_EQ(L"heLL0 w0rld", pipeline(L"  hello world "));
+}
@@ -0,0 +1,147 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include "AllocationCounter.hpp"
+#include "util/string.hpp"
+#include "util/string/scratch.hpp"
+
+namespace scratch = util::string::scratch;
+
+
+class ScratchTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    scratch::release();
+    scratch::resetStats();
+  }
+
+  void TearDown() override {
+    scratch::disable();
+    scratch::release();
+  }
+};
+
+TEST_F(ScratchTest, testDisabledByDefault) {
+  EXPECT_FALSE(scratch::enabled());
+  {
+    scratch::buffer<char> buf(16);
+  }
+  {
+    scratch::buffer<char> buf(16);
+  }
+  EXPECT_EQ(0, scratch::stats().hits);
+  EXPECT_EQ(0, scratch::stats().misses);
+}
+
+TEST_F(ScratchTest, testReusesReleasedBuffers) {
+  scratch::enable();
+  const char *first;
+  {
+    scratch::buffer<char> buf(100);
+    first = buf.data();
+    EXPECT_EQ(100, buf.size());
+  }
+  {
+    scratch::buffer<char> buf(50);
+    EXPECT_EQ(first, buf.data());
+  }
+  EXPECT_EQ(1, scratch::stats().hits);
+  EXPECT_EQ(1, scratch::stats().misses);
+}
+
+TEST_F(ScratchTest, testGrowingCountsAsMiss) {
+  scratch::enable();
+  {
+    scratch::buffer<wchar_t> buf(10);
+  }
+  {
+    scratch::buffer<wchar_t> buf(20);
+    buf.resize(40);
+  }
+  EXPECT_EQ(0, scratch::stats().hits);
+  EXPECT_EQ(3, scratch::stats().misses);
+}
+
+TEST_F(ScratchTest, testRetentionIsBounded) {
+  scratch::limits limits;
+  limits.buffers = 1;
+  limits.capacity = 1024;
+  scratch::enable(limits);
+  {
+    scratch::buffer<char> huge(4096);
+  }
+  EXPECT_EQ(1, scratch::stats().discards);
+  {
+    scratch::buffer<char> a(10);
+    scratch::buffer<char> b(10);
+  }
+  EXPECT_EQ(2, scratch::stats().discards);
+  {
+    scratch::buffer<char> buf(10);
+  }
+  EXPECT_EQ(1, scratch::stats().hits);
+}
+
+TEST_F(ScratchTest, testPoolsArePerThread) {
+  scratch::enable();
+  {
+    scratch::buffer<char> buf(10);
+  }
+  std::thread worker([] {
+    {
+      scratch::buffer<char> buf(10);
+    }
+    EXPECT_EQ(0, scratch::stats().hits);
+    EXPECT_EQ(1, scratch::stats().misses);
+  });
+  worker.join();
+  EXPECT_EQ(1, scratch::stats().misses);
+}
+
+TEST_F(ScratchTest, testFormatReusesItsBuffer) {
+  const std::string LONG = "  the quick brown fox jumps over the lazy dog  ";
+  scratch::enable();
+  util::string::format("%s %d", LONG, 42);
+  // Only the result is allocated once the buffer is pooled
+  EXPECT_ALLOCATIONS(1, util::string::format("%s %d", LONG, 42));
+  EXPECT_EQ(LONG + " 42", util::string::format("%s %d", LONG, 42));
+  EXPECT_EQ(2, scratch::stats().hits);
+}
+
+TEST_F(ScratchTest, testWideFormatGrows) {
+  const std::wstring LONG(1000, L'x');
+  EXPECT_EQ(LONG + L"!", util::string::format(L"%ls!", LONG));
+  scratch::enable();
+  EXPECT_EQ(LONG + L"!", util::string::format(L"%ls!", LONG));
+  EXPECT_EQ(L"short", util::string::format(L"%ls", std::wstring(L"short")));
+  EXPECT_EQ(1, scratch::stats().hits);
+}
+
+TEST_F(ScratchTest, testWideFormatPastPooledCapacity) {
+  const std::wstring LONG(70000, L'x');
+  EXPECT_EQ(LONG + L"!", util::string::format(L"%ls!", LONG));
+}
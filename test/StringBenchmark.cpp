@@ -0,0 +1,182 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+#include "AllocationCounter.hpp"
+#include "util/string.hpp"
+#include "util/string/builder.hpp"
+#include "util/string/codec.hpp"
+#include "util/string/csv.hpp"
+#include "util/string/distance.hpp"
+#include "util/string/escape.hpp"
+
+namespace {
+
+const std::string TEXT =
+    "  The quick brown fox jumps over the lazy dog, again and again.  ";
+
+// Runs f for every iteration and reports heap allocations per operation
+// next to the timings. Throughput is counted over bytes, TEXT by default.
+template <typename Function>
+void measure(benchmark::State &state, Function f,
+             std::size_t bytes = TEXT.size()) {
+  AllocationCounter counter;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(f());
+  }
+  state.counters["allocs/op"] = benchmark::Counter(
+      static_cast<double>(counter.allocations()),
+      benchmark::Counter::kAvgIterations);
+  state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+void BM_StartsWith(benchmark::State &state) {
+  measure(state, [] { return util::string::startsWith(TEXT, "  The"); });
+}
+BENCHMARK(BM_StartsWith);
+
+void BM_Contains(benchmark::State &state) {
+  measure(state, [] { return util::string::contains(TEXT, "lazy"); });
+}
+BENCHMARK(BM_Contains);
+
+void BM_Trim(benchmark::State &state) {
+  measure(state, [] { return util::string::trim(TEXT); });
+}
+BENCHMARK(BM_Trim);
+
+void BM_Lowercase(benchmark::State &state) {
+  measure(state, [] { return util::string::lowercase(TEXT); });
+}
+BENCHMARK(BM_Lowercase);
+
+void BM_Replace(benchmark::State &state) {
+  measure(state, [] { return util::string::replace(TEXT, "again", "more"); });
+}
+BENCHMARK(BM_Replace);
+
+void BM_Translate(benchmark::State &state) {
+  measure(state, [] {
+    return util::string::translate(TEXT, "aeiou", "AEIOU");
+  });
+}
+BENCHMARK(BM_Translate);
+
+void BM_Split(benchmark::State &state) {
+  measure(state, [] { return util::string::split(TEXT, ' '); });
+}
+BENCHMARK(BM_Split);
+
+void BM_Join(benchmark::State &state) {
+  const std::vector<std::string> tokens = util::string::split(TEXT, ' ');
+  measure(state, [&] { return util::string::join(tokens, " "); });
+}
+BENCHMARK(BM_Join);
+
+void BM_Format(benchmark::State &state) {
+  measure(state, [] { return util::string::format("%s:%d", TEXT, 42); });
+}
+BENCHMARK(BM_Format);
+
+void BM_EscapeJson(benchmark::State &state) {
+  std::string out;
+  measure(state, [&] {
+    out.clear();
+    util::string::escapeJson(TEXT, out);
+    return out.size();
+  });
+}
+BENCHMARK(BM_EscapeJson);
+
+void BM_EscapeUrl(benchmark::State &state) {
+  std::string out;
+  measure(state, [&] {
+    out.clear();
+    util::string::escapeUrl(TEXT, out);
+    return out.size();
+  });
+}
+BENCHMARK(BM_EscapeUrl);
+
+void BM_EncodeHex(benchmark::State &state) {
+  std::string out;
+  measure(state, [&] {
+    out.clear();
+    util::string::encodeHex(TEXT, out);
+    return out.size();
+  });
+}
+BENCHMARK(BM_EncodeHex);
+
+void BM_EncodeBase64(benchmark::State &state) {
+  std::string out;
+  measure(state, [&] {
+    out.clear();
+    util::string::encodeBase64(TEXT, out);
+    return out.size();
+  });
+}
+BENCHMARK(BM_EncodeBase64);
+
+void BM_Levenshtein(benchmark::State &state) {
+  const util::string::distance_query query(
+      "  The quick brown cat jumps over the lazy dog, again and again.  ");
+  measure(state, [&] { return query.levenshtein(TEXT); });
+}
+BENCHMARK(BM_Levenshtein);
+
+void BM_Builder(benchmark::State &state) {
+  measure(state, [] {
+    util::string::string_builder builder;
+    for (int i = 0; i < 100; i++) {
+      builder.append(TEXT).appendFormat("%d\n", i);
+    }
+    return builder.str().size();
+  });
+}
+BENCHMARK(BM_Builder);
+
+void BM_Csv(benchmark::State &state) {
+  std::string csv;
+  for (int i = 0; i < 1000; i++) {
+    csv += std::to_string(i) + ",plain field,\"quoted, with \"\"quotes\"\"\"," +
+        TEXT + "\n";
+  }
+  std::vector<util::string::string_view> fields;
+  measure(state, [&] {
+    util::string::csv_reader reader(csv);
+    std::size_t count = 0;
+    while (reader.next(fields)) {
+      count += fields.size();
+    }
+    return count;
+  }, csv.size());
+}
+BENCHMARK(BM_Csv);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -443,6 +443,46 @@ TEST_F(StringTest, testTrimWithCharForWString) {
   checkTrimWithChar(RAW_TEXT, TEXT, SPACE, BLANK);
 }
 
+TEST_F(StringTest, testTrimWithCharSetForString) {
+  const std::string RAW_TEXT = "\r\n\t hello world \t\r\n";
+  const char *TEXT = "hello world";
+  EXPECT_EQ(TEXT, util::string::trim(RAW_TEXT, " \t\r\n"));
+  EXPECT_EQ("hello world \t\r\n", util::string::ltrim(RAW_TEXT, " \t\r\n"));
+  EXPECT_EQ("\r\n\t hello world", util::string::rtrim(RAW_TEXT, " \t\r\n"));
+  EXPECT_EQ("", util::string::trim(std::string("\r\n"), "\r\n"));
+  EXPECT_EQ(RAW_TEXT, util::string::trim(RAW_TEXT, ""));
+}
+
+TEST_F(StringTest, testTrimWithCharSetForLongString) {
+  const std::string PADDING(37, ' ');
+  const std::string TEXT = "x" + std::string(40, '-') + "y";
+  const util::string::char_set SET(" -");
+  EXPECT_EQ(TEXT, util::string::trim(PADDING + TEXT + PADDING));
+  EXPECT_EQ(TEXT, util::string::trim(PADDING + TEXT + PADDING, SET));
+  EXPECT_EQ("x", util::string::rtrim(TEXT + PADDING,
+                                     util::string::char_set(" -y")));
+  EXPECT_EQ("", util::string::trim(PADDING + PADDING, SET));
+  EXPECT_EQ(TEXT, util::string::trim(
+      "\t" + TEXT + "\n", util::string::char_set("abcdefghijkl\t\n")));
+}
+
+TEST_F(StringTest, testTrimWithCharSetForStringView) {
+  const std::string RAW_TEXT = "  hello world  ";
+  util::string::string_view view(RAW_TEXT);
+  auto actual = util::string::trim(view, util::string::whitespace());
+  EXPECT_EQ("hello world", actual);
+  EXPECT_EQ(RAW_TEXT.data() + 2, actual.data());
+  EXPECT_EQ("hello world  ", util::string::ltrim(view, " "));
+  EXPECT_EQ("  hello world", util::string::rtrim(view, " "));
+}
+
+TEST_F(StringTest, testTrimWithCharSetForWString) {
+  const std::wstring RAW_TEXT = L"\x3000 hello world\t\x3000";
+  EXPECT_EQ(L"hello world", util::string::trim(RAW_TEXT, L"\x3000 \t"));
+  EXPECT_EQ(L"hello world\t\x3000", util::string::ltrim(RAW_TEXT, L"\x3000 "));
+  EXPECT_EQ(L"\x3000 hello world", util::string::rtrim(RAW_TEXT, L"\x3000\t"));
+}
+
 TEST_F(StringTest, testContainsForString) {
   const std::string TEXT = "hello world";
   const std::string CAPITALIZED = "HELLO WORLD";
@@ -543,6 +583,13 @@ TEST_F(StringTest, formatWithArgsForU8String) {
   EXPECT_EQ(EXPECTED, util::string::format(FORMAT, ARG1, ARG2));
 }
 
+TEST_F(StringTest, formatThrowsForUnconvertibleArguments) {
+  // Neither converts in the "C" locale
+  EXPECT_THROW(util::string::format("%ls", L"\u00e9"),
+               std::invalid_argument);
+  EXPECT_THROW(util::string::format(L"%s", "\xff"), std::invalid_argument);
+}
+
 TEST_F(StringTest, splitForString) {
   const char *TEXT = "hello world";
   const char TOKEN = ' ';
@@ -0,0 +1,87 @@
+/*
+  MIT License
+
+  Copyright (c) 2019 LG Electronics, Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include "util/string/utf8.hpp"
+
+
+class Utf8Test : public ::testing::Test {
+};
+
+TEST_F(Utf8Test, testIsAscii) {
+  EXPECT_TRUE(util::string::utf8::isAscii(""));
+  EXPECT_TRUE(util::string::utf8::isAscii("hello world, hello world"));
+  EXPECT_FALSE(util::string::utf8::isAscii("hello world, hello w\xC3\xB6rld"));
+}
+
+TEST_F(Utf8Test, testIsValid) {
+  EXPECT_TRUE(util::string::utf8::isValid(u8"héllo 世界 \U0001F600"));
+  EXPECT_FALSE(util::string::utf8::isValid("\xC3"));
+  EXPECT_FALSE(util::string::utf8::isValid("\xC0\xAF"));
+  EXPECT_FALSE(util::string::utf8::isValid("\xE0\x80\xAF"));
+  EXPECT_FALSE(util::string::utf8::isValid("\xED\xA0\x80"));
+  EXPECT_FALSE(util::string::utf8::isValid("\xF4\x90\x80\x80"));
+  EXPECT_FALSE(util::string::utf8::isValid("abcdefghijklmnopq\x80"));
+}
+
+TEST_F(Utf8Test, testLength) {
+  EXPECT_EQ(5, util::string::utf8::length("hello"));
+  EXPECT_EQ(4, util::string::utf8::length(u8"hé世\U0001F600"));
+}
+
+TEST_F(Utf8Test, testReverse) {
+  EXPECT_EQ("olleh", util::string::utf8::reverse("hello"));
+  EXPECT_EQ(u8"\U0001F600世éh",
+            util::string::utf8::reverse(u8"hé世\U0001F600"));
+  EXPECT_THROW(util::string::utf8::reverse("ab\xFF"), std::invalid_argument);
+}
+
+TEST_F(Utf8Test, testTrim) {
+  EXPECT_EQ("hello", util::string::utf8::trim(" \t hello \n"));
+  EXPECT_EQ(u8"héllo",
+            util::string::utf8::trim(u8"　  héllo  "));
+  EXPECT_EQ(u8"héllo ",
+            util::string::utf8::ltrim(u8"　héllo "));
+  EXPECT_EQ(u8"　héllo",
+            util::string::utf8::rtrim(u8"　héllo "));
+  EXPECT_EQ("", util::string::utf8::trim(u8"   "));
+}
+
+TEST_F(Utf8Test, testUppercase) {
+  EXPECT_EQ("HELLO", util::string::utf8::uppercase("hello"));
+  EXPECT_EQ(u8"ÉTÉ ΑΒΣ ПРИВЕТ Ÿ",
+            util::string::utf8::uppercase(
+                u8"été αβς привет ÿ"));
+  EXPECT_EQ(u8"ĀĹ世", util::string::utf8::uppercase(u8"āĺ世"));
+}
+
+TEST_F(Utf8Test, testLowercase) {
+  EXPECT_EQ("hello", util::string::utf8::lowercase("HELLO"));
+  EXPECT_EQ(u8"été αβσ привет ÿ",
+            util::string::utf8::lowercase(
+                u8"ÉTÉ ΑΒΣ ПРИВЕТ Ÿ"));
+  EXPECT_EQ(u8"āĺ世", util::string::utf8::lowercase(u8"ĀĹ世"));
+}